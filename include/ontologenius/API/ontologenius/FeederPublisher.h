@@ -1,8 +1,11 @@
 #ifndef ONTOLOGENIUS_FEEDERPUBLISHER_H
 #define ONTOLOGENIUS_FEEDERPUBLISHER_H
 
+#include <array>
 #include <atomic>
 #include <cstdlib>
+#include <string>
+#include <vector>
 #include <unistd.h>
 
 #include "ontologenius/compat/ros.h"
@@ -30,6 +33,7 @@ namespace onto {
                                                         updated_(false),
                                                         pub_(name.empty() ? "ontologenius/insert" : "ontologenius/insert/" + name, 1000),
                                                         stamped_pub_((name.empty()) ? "ontologenius/insert_stamped" : "ontologenius/insert_stamped/" + name, 1000),
+                                                        facts_pub_((name.empty()) ? "ontologenius/insert_facts" : "ontologenius/insert_facts/" + name, 1000),
                                                         commit_sub_(name_.empty() ? "ontologenius/end" : "ontologenius/end/" + name_, 1000, &FeederPublisher::commitCallback, this),
                                                         feeder_notif_sub_(name_.empty() ? "ontologenius/feeder_notifications" : "ontologenius/feeder_notifications/" + name_, 1000, &FeederPublisher::feederNotificationCallback, this),
                                                         reasoners_notif_sub_(name_.empty() ? "ontologenius/reasoner_notifications" : "ontologenius/reasoner_notifications/" + name_, 1000, &FeederPublisher::reasonersNotificationCallback, this)
@@ -144,6 +148,25 @@ namespace onto {
     /// If the time stamp stamp is not defined, the function takes the current ROS time as the time stamp.
     void removeInverseOf(const std::string& property, const std::string& inverse_property, const onto_ros::Time& stamp = onto_ros::Node::get().currentTime());
 
+    /// @brief Adds in a single message the facts that each "from" is linked with "on" by the property "property".
+    /// The facts are applied as with addRelation but are not parsed by the feeder.
+    /// @param relations are the triplets (from, property, on) to add. A data object is given as "type#value".
+    /// @param probability is the probability of the added relations, in ]0,1].
+    /// @param stamp is the time at which the added relations become true.
+    /// If the time stamp stamp is not defined, the function takes the current ROS time as the time stamp.
+    void addRelations(const std::vector<std::array<std::string, 3>>& relations, double probability = 1.0, const onto_ros::Time& stamp = onto_ros::Node::get().currentTime());
+    /// @brief Removes in a single message the facts that each "from" is linked with "on" by the property "property".
+    /// @param relations are the triplets (from, property, on) to remove. A data object is given as "type#value".
+    /// @param stamp is the time at which the removed relations become false.
+    /// If the time stamp stamp is not defined, the function takes the current ROS time as the time stamp.
+    void removeRelations(const std::vector<std::array<std::string, 3>>& relations, const onto_ros::Time& stamp = onto_ros::Node::get().currentTime());
+    /// @brief Publishes a batch of facts as it is.
+    /// An empty name of a fact is replaced by the concept of the corresponding index, as given by the index services.
+    /// The facts are sent on their own topic, they are thus not ordered with the statements sent by the other functions.
+    /// The facts with an unknown index or a probability out of [0, 1] are rejected and notified as feeder failures.
+    /// @param facts are the facts to publish.
+    void publishFacts(const std::vector<OntologeniusFact>& facts);
+
     /// @brief Returns the number of subscribers that are currently connected to the internal ROS publisher.
     size_t getNumSubscribers() { return stamped_pub_.getNumSubscribers(); }
     /// @brief Blocks while no subscribers are currently connected to the internal ROS publisher.
@@ -193,6 +216,7 @@ namespace onto {
 
     onto_ros::Publisher<std_msgs_compat::String> pub_;
     onto_ros::Publisher<OntologeniusStampedString> stamped_pub_;
+    onto_ros::Publisher<OntologeniusFactArray> facts_pub_;
     onto_ros::Subscriber<std_msgs_compat::String> commit_sub_;
     onto_ros::Subscriber<std_msgs_compat::String> feeder_notif_sub_;
     onto_ros::Subscriber<std_msgs_compat::String> reasoners_notif_sub_;
@@ -201,6 +225,7 @@ namespace onto {
 
     void publish(const std::string& str);
     void publishStamped(const std::string& str, const onto_ros::Time& stamp);
+    void publishRelations(uint8_t action, const std::vector<std::array<std::string, 3>>& relations, double probability, const onto_ros::Time& stamp);
 
     void commitCallback(const onto_ros::MessageWrapper<std_msgs_compat::String>& msg);
     void feederNotificationCallback(const onto_ros::MessageWrapper<std_msgs_compat::String>& msg);
@@ -10,6 +10,8 @@
 
 // User-defined message interfaces
 #include <ontologenius/OntologeniusExplanation.h>
+#include <ontologenius/OntologeniusFact.h>
+#include <ontologenius/OntologeniusFactArray.h>
 #include <ontologenius/OntologeniusSparqlIndexResponse.h>
 #include <ontologenius/OntologeniusSparqlResponse.h>
 #include <ontologenius/OntologeniusStampedString.h>
@@ -35,6 +37,8 @@ namespace std_msgs_compat = std_msgs;
 
 // User-defined message interfaces
 #include <ontologenius/msg/ontologenius_explanation.hpp>
+#include <ontologenius/msg/ontologenius_fact.hpp>
+#include <ontologenius/msg/ontologenius_fact_array.hpp>
 #include <ontologenius/msg/ontologenius_sparql_index_response.hpp>
 #include <ontologenius/msg/ontologenius_sparql_response.hpp>
 #include <ontologenius/msg/ontologenius_stamped_string.hpp>
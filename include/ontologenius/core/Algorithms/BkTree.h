@@ -0,0 +1,106 @@
+#ifndef ONTOLOGENIUS_BKTREE_H
+#define ONTOLOGENIUS_BKTREE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ontologenius/core/Algorithms/LevenshteinDistance.h"
+
+namespace ontologenius {
+
+  // Burkhard-Keller tree of words over the Levenshtein distance.
+  // Words can only be added, the tree has to be rebuilt to remove some.
+  // Searches can run concurrently but not with an insertion.
+  class BkTree
+  {
+  public:
+    BkTree() = default;
+
+    void clear() { nodes_.clear(); }
+    size_t size() const { return nodes_.size(); }
+
+    void insert(const std::string& word)
+    {
+      if(nodes_.empty())
+      {
+        nodes_.emplace_back(word);
+        return;
+      }
+
+      uint32_t current = 0;
+      for(;;)
+      {
+        size_t distance = dist_.getRaw(word, nodes_[current].word, word.size() + nodes_[current].word.size());
+        if(distance == 0)
+          return;
+
+        bool found = false;
+        for(auto& child : nodes_[current].childs)
+          if(child.first == distance)
+          {
+            current = child.second;
+            found = true;
+            break;
+          }
+
+        if(found == false)
+        {
+          auto index = (uint32_t)nodes_.size();
+          nodes_[current].childs.emplace_back(distance, index);
+          if(distance > nodes_[current].max_child_distance)
+            nodes_[current].max_child_distance = distance;
+          nodes_.emplace_back(word);
+          return;
+        }
+      }
+    }
+
+    // Calls visitor(word, distance) for each word at most at max_distance of the value.
+    // The visitor returns the maximal distance for the rest of the search, allowing to shrink it.
+    template<typename F>
+    void search(const std::string& value, size_t max_distance, F&& visitor) const
+    {
+      if(nodes_.empty())
+        return;
+
+      LevenshteinDistance dist; // its row of costs can not be shared between the searches
+      std::vector<uint32_t> to_visit(1, 0);
+      while(to_visit.empty() == false)
+      {
+        const Node_t& node = nodes_[to_visit.back()];
+        to_visit.pop_back();
+
+        // over this bound, no child can be close enough
+        size_t bound = max_distance + node.max_child_distance;
+        size_t distance = dist.getRaw(value, node.word, bound);
+        if(distance > bound)
+          continue;
+
+        if(distance <= max_distance)
+          max_distance = visitor(node.word, distance);
+
+        for(const auto& child : node.childs)
+          if((child.first + max_distance >= distance) && (child.first <= distance + max_distance))
+            to_visit.push_back(child.second);
+      }
+    }
+
+  private:
+    struct Node_t
+    {
+      explicit Node_t(const std::string& word) : word(word), max_child_distance(0) {}
+      std::string word;
+      size_t max_child_distance;
+      std::vector<std::pair<size_t, uint32_t>> childs; // distance to the child, index of the child
+    };
+
+    std::vector<Node_t> nodes_;
+    LevenshteinDistance dist_;
+  };
+
+} // namespace ontologenius
+
+#endif // ONTOLOGENIUS_BKTREE_H
@@ -1,15 +1,20 @@
 #ifndef LEVENSHTEINDISTANCE_H
 #define LEVENSHTEINDISTANCE_H
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 namespace ontologenius {
 
+  // The row of costs is kept between two calls,
+  // an instance should thus not be shared between threads.
   class LevenshteinDistance
   {
   public:
     LevenshteinDistance() = default;
 
+    // distance normalized by the length of s2
     double get(const std::string& s1, const std::string& s2)
     {
       const size_t m(s1.size());
@@ -20,38 +25,60 @@ namespace ontologenius {
       if(n == 0)
         return (double)m;
 
-      size_t* costs = new size_t[n + 1];
+      return (double)getRaw(s1, s2, m + n) / (double)n;
+    }
+
+    // number of edits, any distance over max_distance is returned as max_distance + 1
+    size_t getRaw(const std::string& s1, const std::string& s2, size_t max_distance)
+    {
+      const size_t m(s1.size());
+      const size_t n(s2.size());
 
+      if(((m > n) ? m - n : n - m) > max_distance)
+        return max_distance + 1;
+      if(m == 0)
+        return n;
+      if(n == 0)
+        return m;
+
+      costs_.resize(n + 1);
       for(size_t k = 0; k <= n; k++)
-        costs[k] = k;
+        costs_[k] = k;
 
       size_t i = 0;
       for(std::string::const_iterator it1 = s1.begin(); it1 != s1.end(); ++it1, ++i)
       {
-        costs[0] = i + 1;
+        costs_[0] = i + 1;
         size_t corner = i;
+        size_t row_min = costs_[0];
 
         size_t j = 0;
         for(std::string::const_iterator it2 = s2.begin(); it2 != s2.end(); ++it2, ++j)
         {
-          size_t upper = costs[j + 1];
+          size_t upper = costs_[j + 1];
           if(*it1 == *it2)
-            costs[j + 1] = corner;
+            costs_[j + 1] = corner;
           else
           {
             size_t t((upper < corner) ? upper : corner);
-            costs[j + 1] = ((costs[j] < t) ? costs[j] : t) + 1;
+            costs_[j + 1] = ((costs_[j] < t) ? costs_[j] : t) + 1;
           }
 
+          if(costs_[j + 1] < row_min)
+            row_min = costs_[j + 1];
           corner = upper;
         }
-      }
 
-      size_t result = costs[n];
-      delete[] costs;
+        // the costs of the next rows can only be greater
+        if(row_min > max_distance)
+          return max_distance + 1;
+      }
 
-      return (double)result / (double)n;
+      return (costs_[n] > max_distance) ? max_distance + 1 : costs_[n];
     }
+
+  private:
+    std::vector<size_t> costs_;
   };
 
 } // namespace ontologenius
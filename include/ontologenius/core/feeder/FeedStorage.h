@@ -1,10 +1,14 @@
 #ifndef ONTOLOGENIUS_FEEDSTORAGE_H
 #define ONTOLOGENIUS_FEEDSTORAGE_H
 
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <mutex>
 #include <queue>
-#include <regex>
 #include <string>
+#include <vector>
 
 namespace ontologenius {
 
@@ -33,9 +37,14 @@ namespace ontologenius {
     std::string from_;
     std::string prop_;
     std::string on_;
+    // indexes of the index services, only used for the empty names
+    int64_t from_index_;
+    int64_t prop_index_;
+    int64_t on_index_;
+    double probability_;
     bool checkout_;
 
-    Feed_t() : action_(action_nop), checkout_(false) {}
+    Feed_t() : action_(action_nop), from_index_(0), prop_index_(0), on_index_(0), probability_(1.0), checkout_(false) {}
   };
 
   class FeedStorage
@@ -48,15 +57,24 @@ namespace ontologenius {
     std::queue<Feed_t> get();
     size_t size() { return fifo_1_.size() + fifo_2_.size(); }
 
-  private:
-    std::regex base_regex_;
-    std::regex simple_regex_;
+    // blocks until some feeds are stored, notify is called or the timeout expires
+    // returns true if some feeds are stored
+    bool wait(std::chrono::milliseconds timeout);
+    void notify() { cv_.notify_all(); }
+
+    // returns false if the string is not a valid feed
+    static bool parse(const std::string& str, Feed_t& feed);
 
+  private:
     std::mutex mutex_;
+    std::condition_variable cv_;
 
     bool queue_choice_;
     std::queue<Feed_t> fifo_1_;
     std::queue<Feed_t> fifo_2_;
+
+    // same characters as the regex \w
+    static bool isWordChar(char c) { return (std::isalnum((unsigned char)c) != 0) || (c == '_'); }
   };
 
 } // namespace ontologenius
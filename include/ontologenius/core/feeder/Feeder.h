@@ -1,6 +1,7 @@
 #ifndef ONTOLOGENIUS_FEEDER_H
 #define ONTOLOGENIUS_FEEDER_H
 
+#include <chrono>
 #include <string>
 #include <vector>
 
@@ -11,13 +12,27 @@ namespace ontologenius {
 
   class Ontology;
 
+  enum FeedType_e
+  {
+    feed_concept,
+    feed_inheritance,
+    feed_inverse_of,
+    feed_language,
+    feed_same_as,
+    feed_relation,
+    feed_invalid
+  };
+
   class Feeder
   {
   public:
     Feeder(Ontology* onto = nullptr, bool versioning = false);
 
     void store(const std::string& feed, const RosTime_t& stamp) { feed_storage_.add(feed, stamp); }
+    void store(std::vector<Feed_t>& feeds) { feed_storage_.add(feeds); }
     bool run();
+    bool waitFeeds(std::chrono::milliseconds timeout) { return feed_storage_.wait(timeout); }
+    void notify() { feed_storage_.notify(); }
     void link(Ontology* onto) { onto_ = onto; }
     void setVersioning(bool do_versioning) { do_versioning_ = do_versioning; }
 
@@ -62,7 +77,16 @@ namespace ontologenius {
 
     std::string current_str_feed_;
 
-    bool addFeed(Feed_t& feed);
+    void resolveIndexes(std::vector<Feed_t>& feeds);
+    void rejectInvalidFeeds(std::vector<Feed_t>& feeds);
+    void applyFeeds(std::vector<Feed_t>& feeds);
+    static FeedType_e getType(const Feed_t& feed);
+    void setCurrentFeed(const Feed_t& feed);
+
+    // The functions below modify the graphs through their Unsafe variants,
+    // the individual, class and property graphs have to be locked by the caller
+    bool applyFeed(Feed_t& feed, FeedType_e type);
+    bool addFeed(Feed_t& feed, FeedType_e type);
 
     bool addDelClass(Action_e& action, std::string& name);
     bool addDelIndiv(Action_e& action, std::string& name);
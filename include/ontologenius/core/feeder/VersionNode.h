@@ -2,20 +2,138 @@
 #define ONTOLOGENIUS_VERSIONNODE_H
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "ontologenius/core/feeder/FeedStorage.h"
 
 namespace ontologenius {
 
+  // Words of the versioned feeds, each of them stored once.
+  // A word is counted once per delta and stored snapshot using it, and its id is
+  // released and given again to a new word once none of them uses it anymore.
+  class VersionWords
+  {
+  public:
+    VersionWords()
+    {
+      words_.emplace_back(""); // id 0 is the empty word and is never released
+      counts_.push_back(1);
+      ids_.emplace("", 0);
+    }
+
+    uint32_t add(const std::string& word)
+    {
+      auto it = ids_.find(word);
+      if(it != ids_.end())
+      {
+        counts_[it->second]++;
+        return it->second;
+      }
+
+      uint32_t id = 0;
+      if(free_ids_.empty() == false)
+      {
+        id = free_ids_.back();
+        free_ids_.pop_back();
+        words_[id] = word;
+        counts_[id] = 1;
+      }
+      else
+      {
+        id = (uint32_t)words_.size();
+        words_.push_back(word);
+        counts_.push_back(1);
+      }
+      ids_.emplace(word, id);
+      return id;
+    }
+
+    void hold(uint32_t id) { counts_[id]++; }
+
+    void remove(uint32_t id)
+    {
+      if((id == 0) || (counts_[id] == 0))
+        return;
+
+      if(--counts_[id] == 0)
+      {
+        ids_.erase(words_[id]);
+        std::string().swap(words_[id]);
+        free_ids_.push_back(id);
+      }
+    }
+
+    const std::string& get(uint32_t id) const { return words_[id]; }
+    size_t size() const { return ids_.size(); }
+
+  private:
+    std::vector<std::string> words_;
+    std::vector<size_t> counts_;
+    std::unordered_map<std::string, uint32_t> ids_;
+    std::vector<uint32_t> free_ids_;
+  };
+
+  struct VersionFact_t
+  {
+    uint32_t from_;
+    uint32_t prop_;
+    uint32_t on_;
+
+    bool operator==(const VersionFact_t& other) const { return (from_ == other.from_) && (prop_ == other.prop_) && (on_ == other.on_); }
+  };
+
+  struct VersionFactHash_t
+  {
+    size_t operator()(const VersionFact_t& fact) const
+    {
+      size_t res = fact.from_;
+      res = res * 1000003 ^ fact.prop_;
+      res = res * 1000003 ^ fact.on_;
+      return res;
+    }
+  };
+
+  // A feed encoded with the ids of its words
+  struct VersionDelta_t
+  {
+    VersionFact_t fact_;
+    Action_e action_;
+    float probability_;
+    RosTime_t stamp_;
+  };
+
+  // The first and last actions on a fact from the root of the versions
+  struct VersionFactState_t
+  {
+    Action_e first_action_;
+    Action_e last_action_;
+    float probability_;
+    RosTime_t stamp_;
+    size_t position_; // position of the last action from the root
+  };
+
+  // The state of the facts at a version, as resulting from all the previous deltas
+  struct VersionState_t
+  {
+    std::unordered_map<VersionFact_t, VersionFactState_t, VersionFactHash_t> facts_;
+    size_t nb_deltas_ = 0;
+
+    void apply(const VersionDelta_t& delta);
+  };
+
   class VersionNode
   {
   public:
     explicit VersionNode(size_t order, VersionNode* prev = nullptr);
     VersionNode(size_t order, const std::string& id);
 
-    void insert(const Feed_t& data) { datas_.push_back(data); }
+    void insert(const VersionDelta_t& delta) { deltas_.push_back(delta); }
     void setId(const std::string& id) { id_ = id; }
     void addNext(VersionNode* next) { nexts_.push_back(next); }
 
@@ -23,17 +141,19 @@ namespace ontologenius {
     bool defined() const { return id_.empty() == false; }
     VersionNode* getPrev() const { return prev_; }
     std::vector<VersionNode*> getNexts() const { return nexts_; }
+    size_t size() const { return deltas_.size(); }
+    const std::vector<VersionDelta_t>& getDeltas() const { return deltas_; }
 
-    std::vector<Feed_t> getDatasDirect();
-    std::vector<Feed_t> getDatasInvert();
-
-    void appendDatasDirect(std::vector<Feed_t>& datas);
-    void appendDatasInvert(std::vector<Feed_t>& datas);
+    void applyDeltas(VersionState_t& state) const;
+    bool hasSnapshot() const { return snapshot_ != nullptr; }
+    const VersionState_t& getSnapshot() const { return *snapshot_; }
+    size_t getSnapshotSize() const { return (snapshot_ == nullptr) ? 0 : snapshot_->facts_.size(); }
+    void setSnapshot(std::unique_ptr<VersionState_t> snapshot);
 
     void unlinkFromPrev();
 
-    void print(int level = 0);
-    std::string toXml(int level = 0);
+    void print(const VersionWords& words, int level = 0);
+    std::string toXml(const VersionWords& words, int level = 0);
 
   private:
     std::string id_;
@@ -42,10 +162,11 @@ namespace ontologenius {
     VersionNode* prev_;
     std::vector<VersionNode*> nexts_;
 
-    std::vector<Feed_t> datas_;
+    std::vector<VersionDelta_t> deltas_;
+    std::unique_ptr<VersionState_t> snapshot_;
 
     std::string getSpaces(int nb, const std::string& symbol = "  ");
-    std::string dataToXml(const Feed_t& data) const;
+    std::string dataToXml(const VersionDelta_t& delta, const VersionWords& words) const;
     std::string orderIdToXml() const;
   };
 
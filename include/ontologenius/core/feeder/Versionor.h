@@ -1,7 +1,9 @@
 #ifndef ONTOLOGENIUS_VERSIONOR_H
 #define ONTOLOGENIUS_VERSIONOR_H
 
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "ontologenius/core/feeder/FeedStorage.h"
 #include "ontologenius/core/feeder/VersionNode.h"
@@ -11,30 +13,46 @@ namespace ontologenius {
   class Versionor
   {
   public:
-    explicit Versionor(FeedStorage* storage);
+    Versionor();
     Versionor(const Versionor& other) = delete;
     ~Versionor();
 
     Versionor& operator=(const Versionor& other) = delete;
 
     void activate(bool activated) { activated_ = activated; }
+    void setSnapshotsMaxSize(size_t max_size) { snapshots_max_size_ = max_size; }
 
     void insert(Feed_t data);
     bool commit(const std::string& id);
-    bool checkout(const std::string& id);
+    bool checkout(const std::string& id, std::vector<Feed_t>& datas);
 
-    void print() { nodes_["0"]->print(); }
+    void print() { nodes_["0"]->print(words_); }
     void exportToXml(const std::string& path);
 
+    size_t getNbWords() const { return words_.size(); }
+
   private:
     bool activated_;
-    FeedStorage* storage_;
     size_t order_;
 
     std::unordered_map<std::string, VersionNode*> nodes_;
     VersionNode* current_node_;
-
-    std::vector<VersionNode*> getPrevs(VersionNode* from_node);
+    VersionWords words_;
+
+    std::vector<VersionNode*> snapshots_; // nodes with a snapshot but the first one, the least recently used first
+    size_t snapshots_size_;               // number of facts in these snapshots
+    size_t snapshots_max_size_;
+
+    VersionDelta_t encode(const Feed_t& data);
+    Feed_t decode(const VersionFact_t& fact, Action_e action, const VersionFactState_t& state);
+    void holdWords(const VersionState_t& state);
+    void releaseWords(const VersionState_t& state);
+    void releaseWords(VersionNode* node);
+    bool needSnapshot(VersionNode* node);
+    void addSnapshot(VersionNode* node);
+    void useSnapshot(VersionNode* node);
+    VersionState_t getState(VersionNode* node);
+    std::vector<Feed_t> getDiff(const VersionState_t& from, const VersionState_t& to);
   };
 
 } // namespace ontologenius
@@ -0,0 +1,399 @@
+#ifndef ONTOLOGENIUS_LABELINDEX_H
+#define ONTOLOGENIUS_LABELINDEX_H
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <regex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "ontologenius/core/Algorithms/BkTree.h"
+
+namespace ontologenius {
+
+  // Branches indexed by their identifier and by the words of their dictionary for each language.
+  // A modified branch is only marked and is indexed again by the next search,
+  // the whole index is built by the first search.
+  // The index is only modified under the exclusive lock of its own mutex so that the searches
+  // run concurrently under its shared lock. As it reads the dictionaries of the branches,
+  // it has to be used under the lock of its graph.
+  template<typename B>
+  class LabelIndex
+  {
+  public:
+    LabelIndex() : valid_(false) {}
+    LabelIndex(const LabelIndex& other) = delete;
+    LabelIndex& operator=(const LabelIndex& other) = delete;
+
+    void update(B* branch)
+    {
+      const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      if(valid_)
+        updated_.insert(branch);
+    }
+
+    // has to be called before the branch is destroyed
+    void remove(B* branch)
+    {
+      const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      if(valid_)
+      {
+        updated_.erase(branch);
+        unindex(branch);
+      }
+    }
+
+    void invalidate()
+    {
+      const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      valid_ = false;
+    }
+
+    // branches having the value as label
+    std::vector<B*> find(const std::string& value, const std::string& lang, bool use_default, const std::vector<B*>& all_branchs)
+    {
+      std::vector<B*> res;
+      const auto lock = lockRefreshed(all_branchs, lang, use_default, search_words);
+
+      if(use_default)
+        get(values_, value, res);
+      auto lang_it = labels_.find(lang);
+      if(lang_it != labels_.end())
+        get(lang_it->second, value, res);
+
+      return res;
+    }
+
+    // branches having a label starting on a word boundary of the value
+    std::vector<B*> findSub(const std::string& value, const std::string& lang, bool use_default, const std::vector<B*>& all_branchs)
+    {
+      std::vector<B*> res;
+      const auto lock = lockRefreshed(all_branchs, lang, use_default, search_words);
+
+      if(use_default)
+        getSub(values_, value, res);
+      auto lang_it = labels_.find(lang);
+      if(lang_it != labels_.end())
+        getSub(lang_it->second, value, res);
+
+      return res;
+    }
+
+    // branches having a label fully matching the regex
+    // only the labels starting with the prefix are tested, it has to be a literal prefix of the regex
+    std::vector<B*> findRegex(const std::regex& regex, const std::string& prefix, const std::string& lang, bool use_default, const std::vector<B*>& all_branchs)
+    {
+      std::vector<B*> res;
+      const auto lock = lockRefreshed(all_branchs, lang, use_default, search_sorted);
+
+      if(use_default)
+        getRegex(values_, regex, prefix, res);
+      auto lang_it = labels_.find(lang);
+      if(lang_it != labels_.end())
+        getRegex(lang_it->second, regex, prefix, res);
+
+      return res;
+    }
+
+    // labels at the lowest distance of the value, if this distance is under the threshold
+    // the distance is the one of LevenshteinDistance::get, normalized by the length of the value
+    std::unordered_set<std::string> findFuzzy(const std::string& value, const std::string& lang, bool use_default, double threshold, const std::vector<B*>& all_branchs)
+    {
+      std::unordered_set<std::string> res;
+      auto cost = [length = value.size()](size_t distance) { return (length == 0) ? (double)distance : (double)distance / (double)length; };
+      if(cost(0) > threshold)
+        return res;
+
+      const double limit = value.empty() ? threshold : threshold * (double)value.size();
+      size_t max_distance = (limit < 1e6) ? (size_t)limit : (size_t)1e6; // no label is that long
+      while(cost(max_distance + 1) <= threshold)
+        max_distance++;
+      while((max_distance > 0) && (cost(max_distance) > threshold))
+        max_distance--;
+
+      const auto lock = lockRefreshed(all_branchs, lang, use_default, search_fuzzy);
+
+      size_t best = max_distance;
+      bool found = false;
+      if(use_default)
+        getFuzzy(values_, value, best, found, res);
+      auto lang_it = labels_.find(lang);
+      if(lang_it != labels_.end())
+        getFuzzy(lang_it->second, value, best, found, res);
+
+      return res;
+    }
+
+    // Characters that any label fully matching the regex starts with.
+    // Stays conservative and returns an empty prefix on alternatives.
+    static std::string getLiteralPrefix(const std::string& regex)
+    {
+      if(regex.find('|') != std::string::npos)
+        return "";
+
+      std::string prefix;
+      size_t i = ((regex.empty() == false) && (regex[0] == '^')) ? 1 : 0;
+      for(; i < regex.size(); i++)
+      {
+        char c = regex[i];
+        if((c == '?') || (c == '*') || (c == '{'))
+        {
+          if(prefix.empty() == false)
+            prefix.pop_back(); // the previous character is optional
+          break;
+        }
+        else if(isWordChar(c) || (c == ' ') || (c == '-'))
+          prefix += c;
+        else if((c == '\\') && (i + 1 < regex.size()) && (isWordChar(regex[i + 1]) == false))
+          prefix += regex[++i];
+        else
+          break;
+      }
+
+      return prefix;
+    }
+
+  private:
+    struct Labels_t
+    {
+      std::unordered_map<std::string, std::vector<B*>> branchs;
+      std::map<size_t, size_t> lengths; // number of labels of each length
+      std::vector<const std::string*> sorted; // keys of branchs in lexicographic order
+      bool sorted_valid = false;
+      BkTree fuzzy; // can still contain removed labels
+      size_t fuzzy_removed = 0;
+      bool fuzzy_valid = false;
+    };
+
+    // structures of the labels used by a search, others than their branchs
+    enum Search_e
+    {
+      search_words,
+      search_sorted,
+      search_fuzzy
+    };
+
+    std::shared_timed_mutex mutex_;
+    bool valid_;
+    Labels_t values_;
+    std::unordered_map<std::string, Labels_t> labels_;
+    std::unordered_map<B*, std::vector<std::pair<Labels_t*, std::string>>> indexed_;
+    std::unordered_set<B*> updated_;
+
+    // Gives a shared lock on the index once up to date for the search.
+    // The index is rebuilt under the exclusive lock, thus released before taking the shared one.
+    std::shared_lock<std::shared_timed_mutex> lockRefreshed(const std::vector<B*>& all_branchs, const std::string& lang, bool use_default, Search_e search)
+    {
+      for(;;)
+      {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        if(isUpToDate(lang, use_default, search))
+          return lock;
+        lock.unlock();
+
+        const std::lock_guard<std::shared_timed_mutex> unique_lock(mutex_);
+        refresh(all_branchs);
+        if(use_default)
+          prepare(values_, search);
+        auto lang_it = labels_.find(lang);
+        if(lang_it != labels_.end())
+          prepare(lang_it->second, search);
+      }
+    }
+
+    bool isUpToDate(const std::string& lang, bool use_default, Search_e search) const
+    {
+      if((valid_ == false) || (updated_.empty() == false))
+        return false;
+      if(use_default && (isPrepared(values_, search) == false))
+        return false;
+      auto lang_it = labels_.find(lang);
+      return (lang_it == labels_.end()) || isPrepared(lang_it->second, search);
+    }
+
+    static bool isPrepared(const Labels_t& labels, Search_e search)
+    {
+      switch(search)
+      {
+      case search_sorted: return labels.sorted_valid;
+      case search_fuzzy: return labels.fuzzy_valid;
+      default: return true;
+      }
+    }
+
+    static void prepare(Labels_t& labels, Search_e search)
+    {
+      if((search == search_sorted) && (labels.sorted_valid == false))
+      {
+        labels.sorted.clear();
+        labels.sorted.reserve(labels.branchs.size());
+        for(const auto& label : labels.branchs)
+          labels.sorted.push_back(&label.first);
+        std::sort(labels.sorted.begin(), labels.sorted.end(), [](auto* a, auto* b) { return *a < *b; });
+        labels.sorted_valid = true;
+      }
+      else if((search == search_fuzzy) && (labels.fuzzy_valid == false))
+      {
+        labels.fuzzy.clear();
+        for(const auto& label : labels.branchs)
+          labels.fuzzy.insert(label.first);
+        labels.fuzzy_removed = 0;
+        labels.fuzzy_valid = true;
+      }
+    }
+
+    void refresh(const std::vector<B*>& all_branchs)
+    {
+      if(valid_ == false)
+      {
+        values_ = Labels_t();
+        labels_.clear();
+        indexed_.clear();
+        updated_.clear();
+        for(auto* branch : all_branchs)
+          index(branch);
+        valid_ = true;
+      }
+      else if(updated_.empty() == false)
+      {
+        for(auto* branch : updated_)
+        {
+          unindex(branch);
+          index(branch);
+        }
+        updated_.clear();
+      }
+    }
+
+    void index(B* branch)
+    {
+      add(values_, branch->value(), branch);
+      auto add_label = [this, branch](const std::string& lang, const std::string& word) { add(labels_[lang], word, branch); };
+      branch->dictionary_.spoken_.forEach(add_label);
+      branch->dictionary_.muted_.forEach(add_label);
+    }
+
+    void add(Labels_t& labels, const std::string& word, B* branch)
+    {
+      if(word.empty())
+        return;
+
+      auto& branchs = labels.branchs[word];
+      if(std::find(branchs.begin(), branchs.end(), branch) != branchs.end())
+        return;
+
+      branchs.push_back(branch);
+      if(branchs.size() == 1)
+      {
+        labels.lengths[word.size()]++;
+        labels.sorted_valid = false;
+        if(labels.fuzzy_valid)
+          labels.fuzzy.insert(word);
+      }
+      indexed_[branch].emplace_back(&labels, word);
+    }
+
+    void unindex(B* branch)
+    {
+      auto it = indexed_.find(branch);
+      if(it == indexed_.end())
+        return;
+
+      for(auto& label : it->second)
+      {
+        auto branchs_it = label.first->branchs.find(label.second);
+        auto& branchs = branchs_it->second;
+        branchs.erase(std::find(branchs.begin(), branchs.end(), branch));
+        if(branchs.empty())
+        {
+          label.first->branchs.erase(branchs_it);
+          label.first->sorted_valid = false;
+          if(++label.first->fuzzy_removed > label.first->branchs.size())
+            label.first->fuzzy_valid = false;
+          auto length_it = label.first->lengths.find(label.second.size());
+          if(--length_it->second == 0)
+            label.first->lengths.erase(length_it);
+        }
+      }
+      indexed_.erase(it);
+    }
+
+    static void get(const Labels_t& labels, const std::string& word, std::vector<B*>& res)
+    {
+      auto it = labels.branchs.find(word);
+      if(it != labels.branchs.end())
+        res.insert(res.end(), it->second.begin(), it->second.end());
+    }
+
+    static bool isWordChar(char c)
+    {
+      return (std::isalnum((unsigned char)c) != 0) || (c == '_');
+    }
+
+    // same positions as the regex \b
+    static bool isBoundary(const std::string& value, size_t pos)
+    {
+      if(pos == 0)
+        return isWordChar(value[0]);
+      else
+        return (isWordChar(value[pos - 1]) != isWordChar(value[pos]));
+    }
+
+    static void getRegex(const Labels_t& labels, const std::regex& regex, const std::string& prefix, std::vector<B*>& res)
+    {
+      auto it = std::lower_bound(labels.sorted.begin(), labels.sorted.end(), prefix, [](auto* label, const std::string& value) { return *label < value; });
+      for(; it != labels.sorted.end(); ++it)
+      {
+        const std::string& label = **it;
+        if(label.compare(0, prefix.size(), prefix) != 0)
+          break;
+        if(std::regex_match(label, regex))
+          get(labels, label, res);
+      }
+    }
+
+    static void getFuzzy(const Labels_t& labels, const std::string& value, size_t& best, bool& found, std::unordered_set<std::string>& res)
+    {
+      labels.fuzzy.search(value, best, [&labels, &best, &found, &res](const std::string& word, size_t distance) {
+        if(labels.branchs.find(word) == labels.branchs.end())
+          return best;
+
+        if((found == false) || (distance < best))
+        {
+          res.clear();
+          best = distance;
+          found = true;
+        }
+        if(distance == best)
+          res.insert(word);
+        return best;
+      });
+    }
+
+    static void getSub(const Labels_t& labels, const std::string& value, std::vector<B*>& res)
+    {
+      for(size_t pos = 0; pos < value.size(); pos++)
+      {
+        if(isBoundary(value, pos) == false)
+          continue;
+
+        for(const auto& length : labels.lengths)
+        {
+          if(length.first > value.size() - pos)
+            break;
+          get(labels, value.substr(pos, length.first), res);
+        }
+      }
+    }
+  };
+
+} // namespace ontologenius
+
+#endif // ONTOLOGENIUS_LABELINDEX_H
@@ -0,0 +1,266 @@
+#ifndef ONTOLOGENIUS_PROPERTYRELATIONINDEX_H
+#define ONTOLOGENIUS_PROPERTYRELATIONINDEX_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "ontologenius/core/ontoGraphs/Branchs/WordTable.h"
+
+namespace ontologenius {
+
+  // Relations (subject, object) grouped by the index of their property.
+  // A relation is a member of its own property and of all the super-properties of it,
+  // so that a query on a property directly gets the relations of its sub-properties.
+  // The ancestors are taken from the property graph G when a property is first used
+  // and are followed through the hierarchy version of G, the index being updated on the
+  // next modification or explicitly with update().
+  // Until then, the queries expand the property through its descendants.
+  template<typename S, typename O, typename G>
+  class PropertyRelationIndex
+  {
+  public:
+    using Relation_t = std::pair<S*, O*>;
+
+    explicit PropertyRelationIndex(G* properties) : properties_(properties), version_(0) {}
+
+    // The functions below modify the index and expect the graph owning it to be locked exclusively
+    void add(index_t property, S* subject, O* object)
+    {
+      update();
+
+      const Relation_t relation(subject, object);
+      auto& own = own_[property];
+      if(own.relations.empty())
+        ancestors_[property] = getAncestors(property);
+      own.push(relation);
+
+      for(const index_t up : ancestors_[property])
+        members_[up].push(relation);
+    }
+
+    // removes a single occurrence of the relation
+    bool remove(index_t property, S* subject, O* object)
+    {
+      update();
+
+      auto own_it = own_.find(property);
+      if(own_it == own_.end())
+        return false;
+
+      const Relation_t relation(subject, object);
+      if(own_it->second.erase(relation) == false)
+        return false;
+
+      auto ancestors_it = ancestors_.find(property);
+      for(const index_t up : ancestors_it->second)
+        eraseMember(up, relation);
+
+      if(own_it->second.relations.empty())
+      {
+        own_.erase(own_it);
+        ancestors_.erase(ancestors_it);
+      }
+      return true;
+    }
+
+    // Moves the relations of the properties whose ancestors changed since the last update
+    void update()
+    {
+      const size_t version = properties_->getHierarchyVersion();
+      if(version == version_)
+        return;
+      version_ = version;
+
+      for(auto& own : own_)
+      {
+        std::vector<index_t> ancestors = getAncestors(own.first);
+        auto& previous = ancestors_[own.first];
+        if(ancestors == previous)
+          continue;
+
+        std::vector<index_t> removed;
+        std::set_difference(previous.begin(), previous.end(), ancestors.begin(), ancestors.end(), std::back_inserter(removed));
+        std::vector<index_t> added;
+        std::set_difference(ancestors.begin(), ancestors.end(), previous.begin(), previous.end(), std::back_inserter(added));
+
+        for(const index_t up : removed)
+          for(auto& relation : own.second.relations)
+            eraseMember(up, relation);
+        for(const index_t up : added)
+        {
+          auto& member = members_[up];
+          for(auto& relation : own.second.relations)
+            member.push(relation);
+        }
+
+        previous = std::move(ancestors);
+      }
+    }
+
+    void clear()
+    {
+      own_.clear();
+      ancestors_.clear();
+      members_.clear();
+    }
+
+    bool isUpToDate() const { return version_ == properties_->getHierarchyVersion(); }
+
+    // Relations of the property and of its sub-properties, the index has to be up to date
+    const std::vector<Relation_t>& get(index_t property) const
+    {
+      static const std::vector<Relation_t> empty;
+      auto it = members_.find(property);
+      if(it == members_.end())
+        return empty;
+      else
+        return it->second.relations;
+    }
+
+    // Calls visitor on each relation of the property or of its sub-properties.
+    // The property graph must not be locked by the caller.
+    template<typename T, typename F>
+    void forEach(const T& property, F visitor) const
+    {
+      if(isUpToDate())
+      {
+        auto* property_branch = properties_->findBranchSafe(property);
+        if(property_branch != nullptr)
+          for(auto& relation : get(property_branch->get()))
+            visitor(relation);
+      }
+      else
+      {
+        for(const index_t id : properties_->getDownId(property))
+        {
+          auto it = own_.find(id);
+          if(it != own_.end())
+            for(auto& relation : it->second.relations)
+              visitor(relation);
+        }
+      }
+    }
+
+    // Tells if the relation exists with the property or one of its sub-properties.
+    // The property graph has to be locked by the caller.
+    bool contains(index_t property, S* subject, O* object) const
+    {
+      const Relation_t relation(subject, object);
+      if(isUpToDate())
+      {
+        auto it = members_.find(property);
+        return (it != members_.end()) && it->second.contains(relation);
+      }
+
+      auto* property_branch = properties_->findBranch(property);
+      if(property_branch == nullptr)
+        return false;
+
+      std::unordered_set<decltype(property_branch)> downs;
+      properties_->getDownPtr(property_branch, downs);
+      for(auto* down : downs)
+      {
+        auto it = own_.find(down->get());
+        if((it != own_.end()) && it->second.contains(relation))
+          return true;
+      }
+      return false;
+    }
+
+  private:
+    struct RelationHash
+    {
+      size_t operator()(const Relation_t& relation) const
+      {
+        const size_t seed = std::hash<S*>()(relation.first);
+        return seed ^ (std::hash<O*>()(relation.second) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+      }
+    };
+
+    // The relations are kept in a vector to be iterated, each one knowing its position
+    // in it so that it can be erased in constant time by swapping it with the last one.
+    struct Bucket
+    {
+      std::vector<Relation_t> relations;
+      std::unordered_multimap<Relation_t, size_t, RelationHash> slots;
+
+      void push(const Relation_t& relation)
+      {
+        slots.emplace(relation, relations.size());
+        relations.push_back(relation);
+      }
+
+      bool erase(const Relation_t& relation)
+      {
+        auto slot_it = slots.find(relation);
+        if(slot_it == slots.end())
+          return false;
+
+        const size_t slot = slot_it->second;
+        slots.erase(slot_it);
+
+        const size_t last = relations.size() - 1;
+        if(slot != last)
+        {
+          auto range = slots.equal_range(relations[last]);
+          for(auto it = range.first; it != range.second; ++it)
+            if(it->second == last)
+            {
+              it->second = slot;
+              break;
+            }
+          relations[slot] = relations[last];
+        }
+        relations.pop_back();
+        return true;
+      }
+
+      bool contains(const Relation_t& relation) const { return slots.find(relation) != slots.end(); }
+    };
+
+    G* properties_;
+    size_t version_;
+
+    std::unordered_map<index_t, Bucket> own_;                    // relations by their own property
+    std::unordered_map<index_t, std::vector<index_t>> ancestors_; // sorted properties each own bucket is a member of
+    std::unordered_map<index_t, Bucket> members_;                // relations by property and super-properties
+
+    std::vector<index_t> getAncestors(index_t property) const
+    {
+      std::vector<index_t> res;
+      auto* property_branch = properties_->findBranch(property);
+      if(property_branch == nullptr)
+        res.push_back(property);
+      else
+      {
+        std::unordered_set<decltype(property_branch)> ups;
+        properties_->getUpPtr(property_branch, ups);
+        res.reserve(ups.size());
+        for(auto* up : ups)
+          res.push_back(up->get());
+      }
+      std::sort(res.begin(), res.end());
+      return res;
+    }
+
+    void eraseMember(index_t property, const Relation_t& relation)
+    {
+      auto it = members_.find(property);
+      if(it == members_.end())
+        return;
+
+      it->second.erase(relation);
+      if(it->second.relations.empty())
+        members_.erase(it);
+    }
+  };
+
+} // namespace ontologenius
+
+#endif // ONTOLOGENIUS_PROPERTYRELATIONINDEX_H
@@ -63,7 +63,7 @@ namespace ontologenius {
   class AnonymousClassBranch : public ValuedNode
   {
   public:
-    explicit AnonymousClassBranch(const std::string& value) : ValuedNode(value), class_equiv_(nullptr), depth_(0) {}
+    AnonymousClassBranch(const std::string& value, WordTable* table, LabelTable* label_table) : ValuedNode(value, table, label_table), class_equiv_(nullptr), depth_(0) {}
 
     ClassBranch* class_equiv_;
     std::vector<AnonymousClassElement*> ano_elems_;
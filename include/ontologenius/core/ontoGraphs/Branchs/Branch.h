@@ -22,7 +22,7 @@ namespace ontologenius {
     RelationsWithInductions<SingleElement<T*>> mothers_;
     std::vector<SingleElement<T*>> disjoints_;
 
-    explicit Branch(const std::string& value) : ValuedNode(value) {}
+    Branch(const std::string& value, WordTable* table, LabelTable* label_table, InducedRelationsPool* induced_pool) : ValuedNode(value, table, label_table), mothers_(induced_pool) {}
   };
 
 } // namespace ontologenius
@@ -29,7 +29,7 @@ namespace ontologenius {
     std::vector<ClassDataRelationElement> data_relations_;
     AnonymousClassBranch* equiv_relations_;
 
-    ClassBranch(const std::string& value = "") : Branch(value), equiv_relations_(nullptr){};
+    ClassBranch(const std::string& value, WordTable* table, LabelTable* label_table, InducedRelationsPool* induced_pool) : Branch(value, table, label_table, induced_pool), equiv_relations_(nullptr){};
   };
 
 } // namespace ontologenius
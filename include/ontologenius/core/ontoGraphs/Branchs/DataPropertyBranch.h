@@ -23,7 +23,7 @@ namespace ontologenius {
     std::vector<ClassElement> domains_;
     std::vector<LiteralNode*> ranges_;
 
-    DataPropertyBranch(const std::string& value = "") : Branch(value){};
+    DataPropertyBranch(const std::string& value, WordTable* table, LabelTable* label_table, InducedRelationsPool* induced_pool) : Branch(value, table, label_table, induced_pool){};
   };
 
 } // namespace ontologenius
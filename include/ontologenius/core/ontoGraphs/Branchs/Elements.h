@@ -5,6 +5,7 @@
 #include <string>
 #include <vector>
 
+#include "ontologenius/core/ontoGraphs/Branchs/Explanation.h"
 #include "ontologenius/core/ontoGraphs/Branchs/RelationsWithInductions.h"
 #include "ontologenius/core/ontoGraphs/Branchs/Triplet.h"
 
@@ -15,20 +16,13 @@ namespace ontologenius {
   public:
     float probability;
     bool inferred;
-    std::vector<std::string> explanation;
+    Explanation explanation;
     // TODO add used rule
-    std::vector<TripletsInterface*> induced_traces;
+    InducedTraces induced_traces;
 
-    std::string getExplanation()
+    std::string getExplanation() const
     {
-      std::string res;
-      for(const auto& exp : explanation)
-      {
-        if(res.empty() == false)
-          res += ", ";
-        res += exp;
-      }
-      return res;
+      return explanation.toString();
     }
 
     bool operator>(float prob) const
@@ -77,6 +71,8 @@ namespace ontologenius {
       this->explanation = other.explanation;
     }
 
+    SingleElement(SingleElement&& other) noexcept = default;
+
     SingleElement& operator=(const SingleElement& other)
     {
       this->elem = other.elem;
@@ -87,6 +83,8 @@ namespace ontologenius {
       return *this;
     }
 
+    SingleElement& operator=(SingleElement&& other) noexcept = default;
+
     bool operator==(const SingleElement& other) const
     {
       return (elem == other.elem);
@@ -135,6 +133,8 @@ namespace ontologenius {
       this->explanation = other.explanation;
     }
 
+    PairElement(PairElement&& other) noexcept = default;
+
     PairElement& operator=(const PairElement& other)
     {
       // A copy constructor with a pointer is dangerous, never delete it
@@ -149,6 +149,8 @@ namespace ontologenius {
       return *this;
     }
 
+    PairElement& operator=(PairElement&& other) noexcept = default;
+
     bool operator==(const PairElement& other) const
     {
       return ((first == other.first) && (second == other.second));
@@ -0,0 +1,183 @@
+#ifndef ONTOLOGENIUS_EXPLANATION_H
+#define ONTOLOGENIUS_EXPLANATION_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ontologenius/core/ontoGraphs/Branchs/Labels.h"
+#include "ontologenius/core/ontoGraphs/Branchs/Triplet.h"
+
+namespace ontologenius {
+
+  class ExplanationTable;
+
+  struct ExplanationRecord
+  {
+    ExplanationTable* table;
+    const std::vector<label_id_t>* facts; // key of the record in the records of the table
+    size_t count;
+  };
+
+  // Compact handle on an explanation of an ExplanationTable.
+  // An empty handle stands for the empty explanation and does not use any table.
+  class Explanation
+  {
+  public:
+    Explanation() : record_(nullptr) {}
+    Explanation(const Explanation& other);
+    Explanation(Explanation&& other) noexcept : record_(other.record_) { other.record_ = nullptr; }
+    ~Explanation();
+
+    Explanation& operator=(const Explanation& other);
+
+    Explanation& operator=(Explanation&& other) noexcept
+    {
+      std::swap(record_, other.record_);
+      return *this;
+    }
+
+    bool empty() const { return record_ == nullptr; }
+
+    std::vector<std::string> getFacts() const;
+    std::string toString() const;
+
+  private:
+    friend class ExplanationTable;
+    explicit Explanation(ExplanationRecord* record) : record_(record) {}
+
+    ExplanationRecord* record_;
+  };
+
+  // Interning table of the explanations of the inferred elements, owned by an ontology.
+  // The facts are interned once and an explanation is stored once for all the elements using it.
+  // Both are reference counted and released once no more referenced, the ids of the facts being reused.
+  class ExplanationTable
+  {
+  public:
+    ExplanationTable() = default;
+    ExplanationTable(const ExplanationTable& other) = delete;
+    ExplanationTable& operator=(const ExplanationTable& other) = delete;
+
+    Explanation add(const std::vector<std::string>& facts);
+    // Gives the equivalent in this table of an explanation of another table
+    Explanation copy(const Explanation& explanation);
+
+    size_t size();
+
+  private:
+    friend class Explanation;
+
+    struct FactsHash
+    {
+      size_t operator()(const std::vector<label_id_t>& facts) const
+      {
+        size_t seed = facts.size();
+        for(label_id_t fact : facts)
+          seed ^= std::hash<label_id_t>()(fact) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        return seed;
+      }
+    };
+
+    std::mutex mutex_; // also protects facts_
+    LabelTable facts_;
+    std::unordered_map<std::vector<label_id_t>, ExplanationRecord, FactsHash> records_;
+
+    void ref(ExplanationRecord* record);
+    void unref(ExplanationRecord* record);
+    std::vector<std::string> getFacts(const ExplanationRecord* record);
+    std::string toString(const ExplanationRecord* record);
+  };
+
+  inline Explanation::Explanation(const Explanation& other) : record_(other.record_)
+  {
+    if(record_ != nullptr)
+      record_->table->ref(record_);
+  }
+
+  inline Explanation::~Explanation()
+  {
+    if(record_ != nullptr)
+      record_->table->unref(record_);
+  }
+
+  inline Explanation& Explanation::operator=(const Explanation& other)
+  {
+    if(other.record_ != record_)
+    {
+      if(other.record_ != nullptr)
+        other.record_->table->ref(other.record_);
+      if(record_ != nullptr)
+        record_->table->unref(record_);
+      record_ = other.record_;
+    }
+    return *this;
+  }
+
+  inline std::vector<std::string> Explanation::getFacts() const
+  {
+    return (record_ == nullptr) ? std::vector<std::string>() : record_->table->getFacts(record_);
+  }
+
+  inline std::string Explanation::toString() const
+  {
+    return (record_ == nullptr) ? std::string() : record_->table->toString(record_);
+  }
+
+  // Triplets in which an inferred element has been registered.
+  // As most of the elements have none, they are only allocated when used.
+  class InducedTraces
+  {
+  public:
+    InducedTraces() = default;
+    InducedTraces(const InducedTraces& other) : traces_(other.traces_ ? std::make_unique<std::vector<TripletsInterface*>>(*other.traces_) : nullptr) {}
+    InducedTraces(InducedTraces&& other) noexcept = default;
+
+    InducedTraces& operator=(const InducedTraces& other)
+    {
+      if(this != &other)
+        traces_ = other.traces_ ? std::make_unique<std::vector<TripletsInterface*>>(*other.traces_) : nullptr;
+      return *this;
+    }
+
+    InducedTraces& operator=(InducedTraces&& other) noexcept = default;
+
+    void emplace_back(TripletsInterface* trace)
+    {
+      if(traces_ == nullptr)
+        traces_ = std::make_unique<std::vector<TripletsInterface*>>();
+      traces_->emplace_back(trace);
+    }
+
+    bool empty() const { return (traces_ == nullptr) || traces_->empty(); }
+    size_t size() const { return (traces_ == nullptr) ? 0 : traces_->size(); }
+
+    TripletsInterface* const* begin() const { return (traces_ == nullptr) ? nullptr : traces_->data(); }
+    TripletsInterface* const* end() const { return (traces_ == nullptr) ? nullptr : traces_->data() + traces_->size(); }
+
+    // On a copy of an ontology, the traces are moved to the copied triplets
+    void remap(const std::unordered_map<TripletsInterface*, TripletsInterface*>& copies)
+    {
+      if(traces_ == nullptr)
+        return;
+
+      for(auto& trace : *traces_)
+      {
+        auto it = copies.find(trace);
+        trace = (it == copies.end()) ? nullptr : it->second;
+      }
+      traces_->erase(std::remove(traces_->begin(), traces_->end(), nullptr), traces_->end());
+    }
+
+  private:
+    std::unique_ptr<std::vector<TripletsInterface*>> traces_;
+  };
+
+} // namespace ontologenius
+
+#endif // ONTOLOGENIUS_EXPLANATION_H
@@ -2,6 +2,7 @@
 #define ONTOLOGENIUS_INDIVIDUALBRANCH_H
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ontologenius/core/ontoGraphs/Branchs/ClassBranch.h"
@@ -27,8 +28,18 @@ namespace ontologenius {
     RelationsWithInductions<IndivDataRelationElement> data_relations_;
     RelationsWithInductions<IndividualElement> same_as_;
     std::vector<IndividualElement> distinct_;
-
-    IndividualBranch(const std::string& value = "") : ValuedNode(value) {}
+    // (property, subject) of every object relation pointing on this individual
+    std::vector<std::pair<ObjectPropertyBranch*, IndividualBranch*>> incoming_object_relations_;
+
+    IndividualBranch(const std::string& value, WordTable* table, LabelTable* label_table, InducedRelationsPool* induced_pool) : ValuedNode(value, table, label_table),
+                                                                                                                             is_a_(induced_pool),
+                                                                                                                             object_relations_(induced_pool),
+                                                                                                                             data_relations_(induced_pool),
+                                                                                                                             same_as_(induced_pool)
+    {}
+
+    void addIncomingRelation(ObjectPropertyBranch* property, IndividualBranch* subject);
+    void removeIncomingRelation(ObjectPropertyBranch* property, IndividualBranch* subject);
 
     int objectRelationExists(ObjectPropertyBranch* property, IndividualBranch* individual);
     int dataRelationExists(DataPropertyBranch* property, LiteralNode* data);
@@ -0,0 +1,106 @@
+#ifndef ONTOLOGENIUS_LABELS_H
+#define ONTOLOGENIUS_LABELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ontologenius {
+
+  using label_id_t = uint32_t;
+
+  // Interning table of the words and languages of the dictionaries of the branchs of a graph.
+  // The words are reference counted and their ids are reused once no more referenced.
+  // The table has no mutex, it is modified under the exclusive lock of its graph
+  // and read under its shared lock, as the dictionaries using it.
+  // The explanation table also interns its facts in one, under its own mutex.
+  class LabelTable
+  {
+  public:
+    LabelTable();
+
+    LabelTable(const LabelTable& other) = delete;
+    LabelTable& operator=(const LabelTable& other) = delete;
+
+    label_id_t add(const std::string& word);
+    label_id_t find(const std::string& word) const; // returns 0 if the word is not in the table
+    void ref(label_id_t id) { counts_[id]++; }
+    void unref(label_id_t id);
+
+    const std::string& get(label_id_t id) const { return words_[id]; }
+
+    size_t size() const { return ids_.size(); }
+
+  private:
+    std::deque<std::string> words_; // a deque as the keys of ids_ view its words
+    std::vector<uint32_t> counts_;
+    std::unordered_map<std::string_view, label_id_t> ids_;
+    std::vector<label_id_t> free_ids_;
+  };
+
+  // Words of a node in several languages, stored as a flat array of interned language and word ids.
+  // The words of a language keep the order in which they have been added.
+  // The labels keep their table, the ones of another table are interned again when assigned.
+  class Labels
+  {
+  public:
+    explicit Labels(LabelTable* table) : table_(table) {}
+    Labels(const Labels& other);
+    Labels(Labels&& other) noexcept = default;
+    ~Labels() { clear(); }
+
+    Labels& operator=(const Labels& other);
+    Labels& operator=(Labels&& other);
+    Labels& operator=(const std::map<std::string, std::vector<std::string>>& labels);
+
+    bool empty() const { return labels_.empty(); }
+    size_t size() const { return labels_.size(); }
+
+    bool has(const std::string& lang) const;
+    bool has(const std::string& lang, const std::string& word) const;
+    std::map<std::string, std::vector<std::string>> toMap() const;
+
+    bool add(const std::string& lang, const std::string& word); // returns false if the word was already there
+    bool remove(const std::string& lang, const std::string& word);
+    void clear();
+
+    // Calls visitor(lang, word) on every word
+    template<typename F>
+    void forEach(F&& visitor) const
+    {
+      for(const auto& label : labels_)
+        visitor(table_->get(label.lang), table_->get(label.word));
+    }
+
+    // Calls visitor(word) on every word of the language
+    template<typename F>
+    void forEach(const std::string& lang, F&& visitor) const
+    {
+      label_id_t lang_id = table_->find(lang);
+      if(lang_id == 0)
+        return;
+
+      for(const auto& label : labels_)
+        if(label.lang == lang_id)
+          visitor(table_->get(label.word));
+    }
+
+  private:
+    struct Label_t
+    {
+      label_id_t lang;
+      label_id_t word;
+    };
+
+    LabelTable* table_;
+    std::vector<Label_t> labels_;
+  };
+
+} // namespace ontologenius
+
+#endif // ONTOLOGENIUS_LABELS_H
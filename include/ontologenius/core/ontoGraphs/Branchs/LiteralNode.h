@@ -14,18 +14,23 @@ namespace ontologenius {
     std::string value_;
     std::string type_;
 
-    static WordTable table;
+    // A literal built this way is not registered in any table and should only be used through toString()
+    LiteralNode(const std::string& type, const std::string& value) : value_(value), type_(type), table_(nullptr), index_(0) {}
 
-    LiteralNode(const std::string& type, const std::string& value) : value_(value), type_(type), index_(0)
+    LiteralNode(const std::string& value, WordTable* table) : table_(table), index_(table->add(value))
     {
-      index_ = table.add(type + "#" + value);
+      set(value);
     }
 
-    explicit LiteralNode(const std::string& value) : index_(table.add(value))
+    ~LiteralNode()
     {
-      set(value);
+      if(table_ != nullptr)
+        table_->remove(index_);
     }
 
+    LiteralNode(const LiteralNode& other) = delete;
+    LiteralNode& operator=(const LiteralNode& other) = delete;
+
     std::string getNs() const
     {
       if((type_ == "real") || (type_ == "rational"))
@@ -41,7 +46,7 @@ namespace ontologenius {
     }
 
     std::string toString() const { return (type_ + "#" + value_); }
-    const std::string& value() const { return table[index_]; }
+    const std::string& value() const { return table_->getHeld(index_); }
     index_t get() const { return -index_; }
     void set(const std::string& value)
     {
@@ -71,6 +76,7 @@ namespace ontologenius {
     }
 
   private:
+    WordTable* table_;
     index_t index_;
   };
 
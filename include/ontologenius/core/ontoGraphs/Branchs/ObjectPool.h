@@ -0,0 +1,103 @@
+#ifndef ONTOLOGENIUS_OBJECTPOOL_H
+#define ONTOLOGENIUS_OBJECTPOOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace ontologenius {
+
+  // Slab allocator for objects of a single type.
+  // Memory is taken in chunks of growing size and released in bulk when the pool is destroyed.
+  // Objects must be explicitly destroyed through the pool before that,
+  // their slots are then reused by the next creations.
+  // The pool is not thread safe, it is protected by the mutex of its owner.
+  template<typename T>
+  class ObjectPool
+  {
+  public:
+    explicit ObjectPool(uint32_t first_chunk_size = 16,
+                        uint32_t max_chunk_size = 1024) : chunks_(nullptr),
+                                                          free_list_(nullptr),
+                                                          next_chunk_size_(first_chunk_size),
+                                                          max_chunk_size_(max_chunk_size)
+    {}
+
+    ObjectPool(const ObjectPool& other) = delete;
+    ObjectPool& operator=(const ObjectPool& other) = delete;
+
+    ~ObjectPool()
+    {
+      while(chunks_ != nullptr)
+      {
+        Slot* next = chunks_->next;
+        delete[] chunks_;
+        chunks_ = next;
+      }
+    }
+
+    template<class... Args>
+    T* create(Args&&... args)
+    {
+      if(free_list_ == nullptr)
+        allocateChunk();
+
+      Slot* slot = free_list_;
+      free_list_ = slot->next;
+      try
+      {
+        return new(slot->storage) T(std::forward<Args>(args)...);
+      }
+      catch(...)
+      {
+        slot->next = free_list_;
+        free_list_ = slot;
+        throw;
+      }
+    }
+
+    void destroy(T* object)
+    {
+      if(object == nullptr)
+        return;
+
+      object->~T();
+      Slot* slot = reinterpret_cast<Slot*>(object);
+      slot->next = free_list_;
+      free_list_ = slot;
+    }
+
+  private:
+    union Slot
+    {
+      Slot* next;
+      alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    Slot* chunks_; // the first slot of each chunk links to the previous chunk
+    Slot* free_list_;
+    uint32_t next_chunk_size_;
+    uint32_t max_chunk_size_;
+
+    void allocateChunk()
+    {
+      Slot* chunk = new Slot[next_chunk_size_ + 1];
+      chunk[0].next = chunks_;
+      chunks_ = chunk;
+
+      for(uint32_t i = next_chunk_size_; i > 0; i--)
+      {
+        chunk[i].next = free_list_;
+        free_list_ = &chunk[i];
+      }
+
+      if(next_chunk_size_ < max_chunk_size_)
+        next_chunk_size_ = std::min(next_chunk_size_ * 2, max_chunk_size_);
+    }
+  };
+
+} // namespace ontologenius
+
+#endif // ONTOLOGENIUS_OBJECTPOOL_H
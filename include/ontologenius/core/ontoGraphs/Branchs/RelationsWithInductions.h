@@ -1,8 +1,11 @@
 #ifndef ONTOLOGENIUS_RELATIONSWITHINDUCTIONS_H
 #define ONTOLOGENIUS_RELATIONSWITHINDUCTIONS_H
 
+#include <unordered_map>
 #include <vector>
 
+#include "ontologenius/core/ontoGraphs/Branchs/Explanation.h"
+#include "ontologenius/core/ontoGraphs/Branchs/ObjectPool.h"
 #include "ontologenius/core/ontoGraphs/Branchs/Triplet.h"
 
 namespace ontologenius {
@@ -16,6 +19,16 @@ namespace ontologenius {
   using InheritedRelationTriplet_t = Triplet_t<IndividualBranch, void, ClassBranch>;
   using InheritedRelationTriplets = Triplets<IndividualBranch, void, ClassBranch>;
 
+  // Both kinds of induced relations of a relation are allocated together.
+  // The object relations are the base to get back the full structure from them.
+  struct InducedRelations_t : public ObjectRelationTriplets
+  {
+    InheritedRelationTriplets inheritance_relations;
+  };
+
+  // Owned by a graph and shared by all the relation sets of its branchs
+  using InducedRelationsPool = ObjectPool<InducedRelations_t>;
+
   template<typename T>
   class RelationsWithInductions
   {
@@ -24,7 +37,7 @@ namespace ontologenius {
     std::vector<ObjectRelationTriplets*> has_induced_object_relations;
     std::vector<InheritedRelationTriplets*> has_induced_inheritance_relations;
 
-    RelationsWithInductions() = default;
+    explicit RelationsWithInductions(InducedRelationsPool* induced_pool) : induced_pool_(induced_pool) {}
     RelationsWithInductions(const RelationsWithInductions& other) = delete;
     ~RelationsWithInductions() { clear(); }
 
@@ -35,34 +48,29 @@ namespace ontologenius {
     size_t pushBack(T& relation)
     {
       relations.emplace_back(relation);
-      has_induced_object_relations.emplace_back(new ObjectRelationTriplets);
-      has_induced_inheritance_relations.emplace_back(new InheritedRelationTriplets);
+      pushInduced();
       return relations.size() - 1;
     }
 
     template<class... Args>
     T& emplaceBack(Args&&... args)
     {
-      has_induced_object_relations.emplace_back(new ObjectRelationTriplets);
-      has_induced_inheritance_relations.emplace_back(new InheritedRelationTriplets);
+      pushInduced();
       return relations.emplace_back(std::forward<Args>(args)...);
     }
 
     void erase(size_t index)
     {
       relations.erase(relations.begin() + index);
-      delete has_induced_object_relations.at(index);
+      induced_pool_->destroy(getInduced(index));
       has_induced_object_relations.erase(has_induced_object_relations.begin() + (int)index);
-      delete has_induced_inheritance_relations.at(index);
       has_induced_inheritance_relations.erase(has_induced_inheritance_relations.begin() + (int)index);
     }
 
     void clear()
     {
-      for(auto* induced_object : has_induced_object_relations)
-        delete induced_object;
-      for(auto* induced_inherit : has_induced_inheritance_relations)
-        delete induced_inherit;
+      for(size_t i = 0; i < has_induced_object_relations.size(); i++)
+        induced_pool_->destroy(getInduced(i));
 
       relations.clear();
       has_induced_object_relations.clear();
@@ -83,6 +91,52 @@ namespace ontologenius {
 
     T& back() { return relations.back(); }
     T& front() { return relations.front(); }
+
+    // Gives the inductions of this copy of other for each induction of other
+    void mapInductions(const RelationsWithInductions& other, std::unordered_map<TripletsInterface*, TripletsInterface*>& copies) const
+    {
+      for(size_t i = 0; i < other.has_induced_object_relations.size(); i++)
+      {
+        copies.emplace(other.has_induced_object_relations[i], has_induced_object_relations.at(i));
+        copies.emplace(other.has_induced_inheritance_relations[i], has_induced_inheritance_relations.at(i));
+      }
+    }
+
+    // Copies the induced triplets of other with the branchs given by the converter
+    // and moves the traces and the explanations of the relations on the copied ontology
+    template<typename Converter>
+    void copyInductions(const RelationsWithInductions& other, const std::unordered_map<TripletsInterface*, TripletsInterface*>& copies,
+                        const Converter& converter, ExplanationTable& explanations)
+    {
+      for(size_t i = 0; i < other.has_induced_object_relations.size(); i++)
+      {
+        for(auto& triplet : other.has_induced_object_relations[i]->triplets)
+          has_induced_object_relations[i]->push(converter(triplet.subject), converter(triplet.predicate), converter(triplet.object));
+        for(auto& triplet : other.has_induced_inheritance_relations[i]->triplets)
+          has_induced_inheritance_relations[i]->push(converter(triplet.subject), triplet.predicate, converter(triplet.object));
+      }
+
+      for(auto& relation : relations)
+      {
+        relation.induced_traces.remap(copies);
+        relation.explanation = explanations.copy(relation.explanation);
+      }
+    }
+
+  private:
+    InducedRelationsPool* induced_pool_;
+
+    void pushInduced()
+    {
+      auto* induced = induced_pool_->create();
+      has_induced_object_relations.emplace_back(induced);
+      has_induced_inheritance_relations.emplace_back(&induced->inheritance_relations);
+    }
+
+    InducedRelations_t* getInduced(size_t index)
+    {
+      return static_cast<InducedRelations_t*>(has_induced_object_relations.at(index));
+    }
   };
 
 } // namespace ontologenius
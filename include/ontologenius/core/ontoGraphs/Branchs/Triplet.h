@@ -1,8 +1,11 @@
 #ifndef ONTOLOGENIUS_TRIPLET_H
 #define ONTOLOGENIUS_TRIPLET_H
 
-#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ontologenius {
@@ -52,14 +55,14 @@ namespace ontologenius {
     P* predicate;
     O* object;
 
-    bool operator==(const Triplet_t& other)
+    bool operator==(const Triplet_t& other) const
     {
       return ((subject == other.subject) &&
               (predicate == other.predicate) &&
               (object == other.object));
     }
 
-    bool equals(S* s, P* p, O* o)
+    bool equals(S* s, P* p, O* o) const
     {
       return ((subject == s) &&
               (predicate == p) &&
@@ -74,6 +77,21 @@ namespace ontologenius {
     virtual bool eraseGeneric(void* s, void* p, void* o) = 0;
   };
 
+  template<typename S, typename P, typename O>
+  struct TripletHash
+  {
+    size_t operator()(const Triplet_t<S, P, O>& triplet) const
+    {
+      size_t seed = std::hash<S*>()(triplet.subject);
+      seed ^= std::hash<P*>()(triplet.predicate) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      seed ^= std::hash<O*>()(triplet.object) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      return seed;
+    }
+  };
+
+  // Set of triplets stored in a vector, a triplet is stored at most once.
+  // Small sets are scanned linearly, larger ones get a hash index of the positions.
+  // Erasing moves the last triplet in place of the erased one.
   template<typename S, typename P, typename O>
   class Triplets : public TripletsInterface
   {
@@ -84,7 +102,15 @@ namespace ontologenius {
                             P* predicate,
                             O* object)
     {
+      size_t index = this->find(subject, predicate, object);
+      if(index != size_t(-1))
+        return triplets[index];
+
       triplets.emplace_back(subject, predicate, object);
+      if(indexes_ != nullptr)
+        indexes_->emplace(triplets.back(), triplets.size() - 1);
+      else if(triplets.size() > index_threshold)
+        buildIndexes();
       return triplets.back();
     }
 
@@ -92,8 +118,7 @@ namespace ontologenius {
                P* predicate,
                O* object)
     {
-      return (std::find_if(triplets.begin(), triplets.end(),
-                           [subject, predicate, object](auto& triplet) { return triplet.equals(subject, predicate, object); }) != triplets.end());
+      return (this->find(subject, predicate, object) != size_t(-1));
     }
 
     size_t size()
@@ -105,6 +130,12 @@ namespace ontologenius {
                 P* predicate,
                 O* object)
     {
+      if(indexes_ != nullptr)
+      {
+        auto it = indexes_->find(Triplet_t<S, P, O>(subject, predicate, object));
+        return (it == indexes_->end()) ? size_t(-1) : it->second;
+      }
+
       for(size_t i = 0; i < triplets.size(); i++)
       {
         if(triplets[i].equals(subject, predicate, object))
@@ -123,16 +154,38 @@ namespace ontologenius {
                O* object)
     {
       size_t index = this->find(subject, predicate, object);
-      if(index != size_t(-1))
+      if(index == size_t(-1))
+        return false;
+
+      if(indexes_ != nullptr)
+        indexes_->erase(triplets[index]);
+
+      if(index != triplets.size() - 1)
       {
-        triplets.erase(triplets.begin() + index);
-        return true;
+        triplets[index] = triplets.back();
+        if(indexes_ != nullptr)
+          (*indexes_)[triplets[index]] = index;
       }
-      else
-        return false;
+      triplets.pop_back();
+
+      if((indexes_ != nullptr) && (triplets.size() < index_threshold / 2))
+        indexes_.reset();
+      return true;
     }
 
     std::vector<Triplet_t<S, P, O>> triplets;
+
+  private:
+    static constexpr size_t index_threshold = 16;
+    std::unique_ptr<std::unordered_map<Triplet_t<S, P, O>, size_t, TripletHash<S, P, O>>> indexes_;
+
+    void buildIndexes()
+    {
+      indexes_ = std::make_unique<std::unordered_map<Triplet_t<S, P, O>, size_t, TripletHash<S, P, O>>>();
+      indexes_->reserve(triplets.size());
+      for(size_t i = 0; i < triplets.size(); i++)
+        indexes_->emplace(triplets[i], i);
+    }
   };
 
 } // namespace ontologenius
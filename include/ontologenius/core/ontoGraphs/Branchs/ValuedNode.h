@@ -1,11 +1,11 @@
 #ifndef ONTOLOGENIUS_VALUEDNODE_H
 #define ONTOLOGENIUS_VALUEDNODE_H
 
-#include <algorithm>
 #include <map>
 #include <string>
 #include <vector>
 
+#include "ontologenius/core/ontoGraphs/Branchs/Labels.h"
 #include "ontologenius/core/ontoGraphs/Branchs/WordTable.h"
 
 namespace ontologenius {
@@ -24,30 +24,30 @@ namespace ontologenius {
   class Dictionary
   {
   public:
-    std::map<std::string, std::vector<std::string>> spoken_;
-    std::map<std::string, std::vector<std::string>> muted_;
+    explicit Dictionary(LabelTable* table) : spoken_(table), muted_(table) {}
+
+    Labels spoken_;
+    Labels muted_;
   };
 
   class ValuedNode : public UpdatableNode
   {
   public:
-    explicit ValuedNode(const std::string& value) : index_(table.add(value)) {}
+    ValuedNode(const std::string& value, WordTable* table, LabelTable* label_table) : dictionary_(label_table),
+                                                                                      steady_dictionary_(label_table),
+                                                                                      table_(table),
+                                                                                      index_(table->add(value)) {}
+    ~ValuedNode() { table_->remove(index_); }
 
-    const index_t& get() const { return index_; }
-    const std::string& value() const { return table[index_]; }
+    ValuedNode(const ValuedNode& other) = delete;
+    ValuedNode& operator=(const ValuedNode& other) = delete;
 
-    static WordTable table;
+    const index_t& get() const { return index_; }
+    const std::string& value() const { return table_->getHeld(index_); }
 
     Dictionary dictionary_;
     Dictionary steady_dictionary_;
 
-    template<typename C>
-    void conditionalPushBack(std::vector<C>& vect, const C& data)
-    {
-      if(std::find(vect.begin(), vect.end(), data) == vect.end())
-        vect.push_back(data);
-    }
-
     void setSteadyDictionary(const std::string& lang, const std::string& word);
     void setSteadyMutedDictionary(const std::string& lang, const std::string& word);
     void setSteadyDictionary(const std::map<std::string, std::vector<std::string>>& dictionary);
@@ -63,6 +63,7 @@ namespace ontologenius {
     }
 
   private:
+    WordTable* table_;
     index_t index_;
   };
 
@@ -1,8 +1,13 @@
 #ifndef ONTOLOGENIUS_WORDTABLE_H
 #define ONTOLOGENIUS_WORDTABLE_H
 
+#include <cstddef>
 #include <cstdint>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -10,48 +15,120 @@ namespace ontologenius {
 
   using index_t = int64_t;
 
+  // Interning table owned by an ontology.
+  // Identical words share the same index. The index of a word is released
+  // once all the nodes referencing it have been removed. A released index is
+  // given again to a new word only after reuse_delay other indexes have been
+  // released, for an index still held by a client to not resolve right away
+  // to another word. The table thus only grows with the number of used words.
+  // The words are in a deque for the references given by getHeld to remain valid.
   class WordTable
   {
   public:
+    static constexpr size_t reuse_delay = 1024;
+
     WordTable()
     {
       table_.emplace_back(""); // index 0 is reserved for the "no result index"
+      counts_.push_back(1);
     }
 
+    // The copied words keep their index, this way an index remains valid on a copy of an ontology.
+    // The counts start again from zero as they are rebuilt by the nodes of the copy.
+    explicit WordTable(const WordTable& other)
+    {
+      const std::shared_lock<std::shared_timed_mutex> lock(other.mutex_);
+      table_ = other.table_;
+      counts_.resize(table_.size(), 0);
+      counts_[0] = 1;
+      indexes_ = other.indexes_;
+      free_indexes_ = other.free_indexes_;
+    }
+
+    WordTable& operator=(const WordTable& other) = delete;
+
     index_t add(const std::string& value)
     {
-      table_.push_back(value);
-      return (index_t)table_.size() - 1;
+      const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      auto it = indexes_.find(value);
+      if(it != indexes_.end())
+      {
+        counts_[it->second]++;
+        return it->second;
+      }
+
+      index_t index = 0;
+      if(free_indexes_.size() > reuse_delay)
+      {
+        index = free_indexes_.front();
+        free_indexes_.pop_front();
+        table_[index] = value;
+        counts_[index] = 1;
+      }
+      else
+      {
+        index = (index_t)table_.size();
+        table_.push_back(value);
+        counts_.push_back(1);
+      }
+      indexes_.emplace(value, index);
+      return index;
+    }
+
+    void remove(index_t index)
+    {
+      const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      if((index <= 0) || (index >= (index_t)table_.size()) || (counts_[index] == 0))
+        return;
+
+      if(--counts_[index] == 0)
+      {
+        indexes_.erase(table_[index]);
+        std::string().swap(table_[index]);
+        free_indexes_.push_back(index);
+      }
     }
 
-    std::string& get(index_t index)
+    // the words are copied under the lock as they can be released concurrently
+    std::string get(index_t index) const
     {
+      const std::shared_lock<std::shared_timed_mutex> lock(mutex_);
       return table_[index];
     }
 
-    std::string& operator[](index_t index)
+    std::string operator[](index_t index) const
     {
+      const std::shared_lock<std::shared_timed_mutex> lock(mutex_);
       return table_[index];
     }
 
-    const std::string& operator[](index_t index) const
+    // The word of an index on which the caller holds a count, as a node on its own index.
+    // It can be neither released nor replaced meanwhile and is thus given by reference.
+    const std::string& getHeld(index_t index) const
     {
+      const std::shared_lock<std::shared_timed_mutex> lock(mutex_);
       return table_[index];
     }
 
     void index2string(std::unordered_set<std::string>& res, const std::unordered_set<index_t>& base)
     {
+      const std::shared_lock<std::shared_timed_mutex> lock(mutex_);
       for(index_t i : base)
         res.insert(table_[i]);
     }
 
     size_t size() const
     {
+      const std::shared_lock<std::shared_timed_mutex> lock(mutex_);
       return table_.size();
     }
 
   private:
-    std::vector<std::string> table_;
+    std::deque<std::string> table_;
+    std::vector<size_t> counts_;
+    std::unordered_map<std::string, index_t> indexes_;
+    std::deque<index_t> free_indexes_; // the released indexes, the oldest first
+    mutable std::shared_timed_mutex mutex_;
   };
 
 } // namespace ontologenius
@@ -151,9 +151,9 @@ namespace ontologenius {
 
   public:
     AnonymousClassGraph(ClassGraph* class_graph, ObjectPropertyGraph* object_property_graph,
-                        DataPropertyGraph* data_property_graph, IndividualGraph* individual_graph);
+                        DataPropertyGraph* data_property_graph, IndividualGraph* individual_graph, WordTable* table);
     AnonymousClassGraph(const AnonymousClassGraph& other, ClassGraph* class_graph, ObjectPropertyGraph* object_property_graph,
-                        DataPropertyGraph* data_property_graph, IndividualGraph* individual_graph);
+                        DataPropertyGraph* data_property_graph, IndividualGraph* individual_graph, WordTable* table);
     ~AnonymousClassGraph() override = default;
 
     AnonymousClassElement* createElement(ExpressionMember_t* exp_leaf);
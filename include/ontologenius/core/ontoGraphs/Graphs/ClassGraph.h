@@ -7,6 +7,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "ontologenius/core/ontoGraphs/BranchContainer/PropertyRelationIndex.h"
 #include "ontologenius/core/ontoGraphs/Branchs/ClassBranch.h"
 #include "ontologenius/core/ontoGraphs/Graphs/OntoGraph.h"
 
@@ -43,8 +44,8 @@ namespace ontologenius {
     friend ClassChecker;
 
   public:
-    ClassGraph(IndividualGraph* individual_graph, ObjectPropertyGraph* object_property_graph, DataPropertyGraph* data_property_graph);
-    ClassGraph(const ClassGraph& other, IndividualGraph* individual_graph, ObjectPropertyGraph* object_property_graph, DataPropertyGraph* data_property_graph);
+    ClassGraph(IndividualGraph* individual_graph, ObjectPropertyGraph* object_property_graph, DataPropertyGraph* data_property_graph, WordTable* table);
+    ClassGraph(const ClassGraph& other, IndividualGraph* individual_graph, ObjectPropertyGraph* object_property_graph, DataPropertyGraph* data_property_graph, WordTable* table);
     ~ClassGraph() override = default;
 
     ClassBranch* add(const std::string& value, ObjectVectors_t& object_vector);
@@ -83,17 +84,31 @@ namespace ontologenius {
     std::unordered_set<IndividualBranch*> getDownIndividualPtrSafe(ClassBranch* branch, size_t depth = -1);
     void getDownIndividualPtr(ClassBranch* branch, std::unordered_set<IndividualBranch*>& res, size_t depth = -1, size_t current_depth = 0);
 
+    // The Unsafe variants expect the individual, class and property graphs to be locked by the caller
     void deleteClass(ClassBranch* class_branch);
+    void deleteClassUnsafe(ClassBranch* class_branch);
     bool addInheritage(const std::string& branch_base, const std::string& branch_inherited);
+    bool addInheritageUnsafe(const std::string& branch_base, const std::string& branch_inherited);
     int deleteRelationsOnClass(ClassBranch* class_branch, std::vector<ClassBranch*> vect);
-    void addRelation(ClassBranch* class_from, const std::string& property, const std::string& class_on);
-    void addRelation(ClassBranch* class_from, const std::string& property, const std::string& type, const std::string& data);
-    void addRelationInvert(const std::string& class_from, const std::string& property, ClassBranch* class_on);
+    void addRelation(ClassBranch* class_from, const std::string& property, const std::string& class_on, double proba = 1.0);
+    void addRelationUnsafe(ClassBranch* class_from, const std::string& property, const std::string& class_on, double proba = 1.0);
+    void addRelation(ClassBranch* class_from, const std::string& property, const std::string& type, const std::string& data, double proba = 1.0);
+    void addRelationUnsafe(ClassBranch* class_from, const std::string& property, const std::string& type, const std::string& data, double proba = 1.0);
+    void addRelationInvert(const std::string& class_from, const std::string& property, ClassBranch* class_on, double proba = 1.0);
+    void addRelationInvertUnsafe(const std::string& class_from, const std::string& property, ClassBranch* class_on, double proba = 1.0);
     void removeRelation(const std::string& class_from, const std::string& property, const std::string& class_on);
+    void removeRelationUnsafe(const std::string& class_from, const std::string& property, const std::string& class_on);
     void removeRelation(const std::string& class_from, const std::string& property, const std::string& type, const std::string& data);
+    void removeRelationUnsafe(const std::string& class_from, const std::string& property, const std::string& type, const std::string& data);
 
     std::pair<bool, ClassBranch*> checkDomainOrRange(const std::unordered_set<ClassBranch*>& domain_or_range, const std::unordered_set<ClassBranch*>& classes);
 
+    // follows the changes of the property taxonomy in the relation indexes
+    void updateRelationIndexesUnsafe();
+
+    PropertyRelationIndex<ClassBranch, ClassBranch, ObjectPropertyGraph> object_relations_index_;
+    PropertyRelationIndex<ClassBranch, LiteralNode, DataPropertyGraph> data_relations_index_;
+
   private:
     ObjectPropertyGraph* object_property_graph_;
     DataPropertyGraph* data_property_graph_;
@@ -106,7 +121,7 @@ namespace ontologenius {
     template<typename T>
     void getRelationFrom(ClassBranch* class_branch, std::unordered_set<T>& res, int depth);
     template<typename T>
-    void getRelatedFrom(const std::unordered_set<index_t>& object_properties, const std::unordered_set<index_t>& data_properties, std::unordered_set<T>& res);
+    void getRelatedFrom(const T& property, std::unordered_set<T>& res);
     template<typename T>
     void getRelationOnObjectProperties(const std::string& class_name, std::unordered_set<T>& res, int depth);
     void getRelationOnDataProperties(const std::string& class_name, std::unordered_set<std::string>& res, int depth);
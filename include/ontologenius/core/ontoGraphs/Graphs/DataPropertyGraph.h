@@ -43,9 +43,9 @@ namespace ontologenius {
     friend AnonymousClassGraph;
 
   public:
-    explicit DataPropertyGraph(IndividualGraph* individual_graph, ClassGraph* class_graph);
-    DataPropertyGraph(const DataPropertyGraph& other, IndividualGraph* individual_graph, ClassGraph* class_graph);
-    ~DataPropertyGraph() override = default;
+    DataPropertyGraph(IndividualGraph* individual_graph, ClassGraph* class_graph, WordTable* table, WordTable* literal_table);
+    DataPropertyGraph(const DataPropertyGraph& other, IndividualGraph* individual_graph, ClassGraph* class_graph, WordTable* table, WordTable* literal_table);
+    ~DataPropertyGraph() override;
 
     void deepCopy(const DataPropertyGraph& other);
 
@@ -68,7 +68,10 @@ namespace ontologenius {
 
   private:
     ClassGraph* class_graph_;
+    ObjectPool<LiteralNode> literal_pool_;
     BranchContainerSet<LiteralNode> literal_container_;
+    std::vector<LiteralNode*> all_literals_;
+    WordTable* literal_table_;
 
     template<typename T>
     void getDomain(DataPropertyBranch* branch, size_t depth, std::unordered_set<T>& res, std::unordered_set<DataPropertyBranch*>& up_trace);
@@ -1,6 +1,7 @@
 #ifndef ONTOLOGENIUS_GRAPH_H
 #define ONTOLOGENIUS_GRAPH_H
 
+#include <algorithm>
 #include <exception>
 #include <map>
 #include <mutex> // For std::unique_lock
@@ -8,16 +9,21 @@
 #include <regex>
 #include <shared_mutex>
 #include <string>
+#include <type_traits>
+#include <unordered_set>
 #include <vector>
 
-#include "ontologenius/core/Algorithms/LevenshteinDistance.h"
 #include "ontologenius/core/ontoGraphs/BranchContainer/BranchContainerDyn.h"
 #include "ontologenius/core/ontoGraphs/BranchContainer/BranchContainerMap.h"
 #include "ontologenius/core/ontoGraphs/BranchContainer/BranchContainerSet.h"
+#include "ontologenius/core/ontoGraphs/BranchContainer/LabelIndex.h"
 #include "ontologenius/core/ontoGraphs/Branchs/Elements.h"
+#include "ontologenius/core/ontoGraphs/Branchs/Labels.h"
 #include "ontologenius/core/ontoGraphs/Branchs/LiteralNode.h"
+#include "ontologenius/core/ontoGraphs/Branchs/ObjectPool.h"
 #include "ontologenius/core/ontoGraphs/Branchs/RelationsWithInductions.h"
 #include "ontologenius/core/ontoGraphs/Branchs/ValuedNode.h"
+#include "ontologenius/core/ontoGraphs/Branchs/WordTable.h"
 
 namespace ontologenius {
 
@@ -39,16 +45,18 @@ namespace ontologenius {
     static_assert(std::is_base_of<ValuedNode, B>::value, "B must be derived from ValuedNode");
 
   public:
-    Graph() : language_("en") {}
+    explicit Graph(WordTable* table) : table_(table), language_("en"), deterministic_names_(false) {}
     virtual ~Graph()
     {
       for(auto& branch : all_branchs_)
-        delete branch;
+        pool_.destroy(branch);
       all_branchs_.clear();
     }
 
     void setLanguage(const std::string& language) { language_ = language; }
     std::string getLanguage() const { return language_; }
+    // getName always gives the first name without underscore rather than a random one
+    void setDeterministicNames(bool deterministic) { deterministic_names_ = deterministic; }
 
     const std::vector<B*>& get() { return this->all_branchs_; }
     const std::vector<B*>& getSafe()
@@ -77,8 +85,12 @@ namespace ontologenius {
 
     bool addLang(const std::string& branch_str, const std::string& lang, const std::string& name);
     bool addLang(B* branch, const std::string& lang, const std::string& name);
+    bool addLangUnsafe(const std::string& branch_str, const std::string& lang, const std::string& name);
+    bool addLangUnsafe(B* branch, const std::string& lang, const std::string& name);
     bool removeLang(const std::string& branch_str, const std::string& lang, const std::string& name);
     bool removeLang(B* branch, const std::string& lang, const std::string& name);
+    bool removeLangUnsafe(const std::string& branch_str, const std::string& lang, const std::string& name);
+    bool removeLangUnsafe(B* branch, const std::string& lang, const std::string& name);
 
     template<typename T>
     std::string getName(const T& value, bool use_default = true);
@@ -95,25 +107,125 @@ namespace ontologenius {
     std::unordered_set<T> findRegex(const std::string& regex, bool use_default = true);
     std::unordered_set<std::string> findFuzzy(const std::string& value, bool use_default = true, double threshold = 0.5);
 
+    // uniform index in [0, size), the generator is seeded once per thread
+    static size_t getRandomIndex(size_t size)
+    {
+      static thread_local std::mt19937 gen(std::random_device{}());
+      return std::uniform_int_distribution<size_t>(0, size - 1)(gen);
+    }
+
+    // The updates have to be marked through the graph for the reasoners
+    // to only go through the updated branchs. The updates can be marked from
+    // another graph or a reasoner not holding the lock of this graph, so the
+    // updated branchs have their own mutex, always taken last.
+    void setUpdated(B* branch)
+    {
+      const std::lock_guard<std::mutex> lock(updated_mutex_);
+      branch->updated_ = true;
+      updated_branchs_.insert(branch);
+    }
+
+    void addUpdate(B* branch)
+    {
+      const std::lock_guard<std::mutex> lock(updated_mutex_);
+      branch->nb_updates_++;
+      updated_branchs_.insert(branch);
+    }
+
+    bool hasUpdated() const
+    {
+      const std::lock_guard<std::mutex> lock(updated_mutex_);
+      return updated_branchs_.empty() == false;
+    }
+
+    // branchs possibly updated, in the order of their index
+    std::vector<B*> getUpdated() const
+    {
+      std::unique_lock<std::mutex> lock(updated_mutex_);
+      std::vector<B*> res(updated_branchs_.begin(), updated_branchs_.end());
+      lock.unlock();
+      std::sort(res.begin(), res.end(), [](B* a, B* b) { return a->get() < b->get(); });
+      return res;
+    }
+
+    // the branchs updated by the reasoners during a pass are the updated ones of the next pass
+    void computeUpdates()
+    {
+      const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      const std::lock_guard<std::mutex> lock_updated(updated_mutex_);
+      for(auto it = updated_branchs_.begin(); it != updated_branchs_.end();)
+      {
+        B* branch = *it;
+        if(branch->nb_updates_ == 0)
+        {
+          branch->updated_ = false;
+          it = updated_branchs_.erase(it);
+        }
+        else
+        {
+          branch->nb_updates_ = 0;
+          branch->updated_ = true;
+          ++it;
+        }
+      }
+    }
+
+    LabelTable label_table_; // interns the dictionaries of the branchs, used under mutex_
+    InducedRelationsPool induced_pool_; // allocates the inductions of the branchs relations
+    ObjectPool<B> pool_; // allocates the branchs, must outlive them
     BranchContainerSet<B> container_;
+    LabelIndex<B> labels_; // has to be updated when a dictionary changes
     std::vector<B*> all_branchs_;
+    std::vector<B*> ordered_branchs_; // contains the branchs ordered wrt their index
+                                      // unused indexes have nullptr in
+    std::unordered_set<B*> updated_branchs_; // contains at least the branchs updated_ or with nb_updates_
+    mutable std::mutex updated_mutex_;       // only protects updated_branchs_
+    WordTable* table_; // owned by the ontology and shared between its graphs
 
     std::string language_;
+    bool deterministic_names_;
 
     mutable std::shared_timed_mutex mutex_;
     // use std::lock_guard<std::shared_timed_mutex> lock(mutex_); to WRITE A DATA
     // use std::shared_lock<std::shared_timed_mutex> lock(mutex_); to READ A DATA
 
-    void removeFromDictionary(std::map<std::string, std::vector<std::string>>& dictionary, const std::string& lang, const std::string& word)
+    // only the branchs with relations take the pool of inductions
+    B* createBranch(const std::string& value)
+    {
+      return createBranch(value, std::is_constructible<B, const std::string&, WordTable*, LabelTable*, InducedRelationsPool*>());
+    }
+
+    B* createBranch(const std::string& value, std::true_type /*with inductions*/)
+    {
+      return pool_.create(value, table_, &label_table_, &induced_pool_);
+    }
+
+    B* createBranch(const std::string& value, std::false_type /*with inductions*/)
     {
-      if(dictionary.find(lang) != dictionary.end())
+      return pool_.create(value, table_, &label_table_);
+    }
+
+    void insertBranchInVectors(B* branch)
+    {
+      all_branchs_.push_back(branch);
+      if((size_t)branch->get() >= ordered_branchs_.size())
+        ordered_branchs_.resize(branch->get() + 1, nullptr);
+      ordered_branchs_[branch->get()] = branch;
+      labels_.update(branch);
+      const std::lock_guard<std::mutex> lock(updated_mutex_);
+      updated_branchs_.insert(branch); // a new branch is updated
+    }
+
+    void removeBranchInVectors(size_t vector_index)
+    {
+      const index_t index = all_branchs_[vector_index]->get();
+      labels_.remove(all_branchs_[vector_index]);
       {
-        for(size_t i = 0; i < dictionary[lang].size();)
-          if(dictionary[lang][i] == word)
-            dictionary[lang].erase(dictionary[lang].begin() + (int)i);
-          else
-            i++;
+        const std::lock_guard<std::mutex> lock(updated_mutex_);
+        updated_branchs_.erase(all_branchs_[vector_index]);
       }
+      all_branchs_.erase(all_branchs_.begin() + (int)vector_index);
+      ordered_branchs_[index] = nullptr;
     }
 
     template<class T>
@@ -297,13 +409,16 @@ namespace ontologenius {
   B* Graph<B>::findBranchSafe(index_t index)
   {
     std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    return container_.find(ValuedNode::table.get(index));
+    return findBranch(index);
   }
 
   template<typename B>
   B* Graph<B>::findBranch(index_t index)
   {
-    return container_.find(ValuedNode::table.get(index));
+    if((index > 0) && (index < (index_t)ordered_branchs_.size()))
+      return ordered_branchs_[index];
+    else
+      return nullptr;
   }
 
   template<typename B>
@@ -318,8 +433,8 @@ namespace ontologenius {
   template<typename B>
   B* Graph<B>::newDefaultBranch(const std::string& name)
   {
-    auto* branch = new B(name);
-    all_branchs_.push_back(branch);
+    auto* branch = createBranch(name);
+    insertBranchInVectors(branch);
     container_.insert(branch);
     return branch;
   }
@@ -363,8 +478,8 @@ namespace ontologenius {
   std::string Graph<B>::getIdentifier(index_t index)
   {
     std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    if((index > 0) && (index < (index_t)ValuedNode::table.size()))
-      return ValuedNode::table[index];
+    if((index > 0) && (index < (index_t)table_->size()))
+      return (*table_)[index];
     else
       return "";
   }
@@ -373,7 +488,15 @@ namespace ontologenius {
   std::vector<std::string> Graph<B>::getIdentifiers(const std::vector<index_t>& indexes)
   {
     std::vector<std::string> res;
-    std::transform(indexes.cbegin(), indexes.cend(), std::back_inserter(res), [this](const auto& index) { return getIdentifier(index); });
+    res.reserve(indexes.size());
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    for(auto index : indexes)
+    {
+      if((index > 0) && (index < (index_t)table_->size()))
+        res.push_back((*table_)[index]);
+      else
+        res.emplace_back();
+    }
     return res;
   }
 
@@ -393,12 +516,25 @@ namespace ontologenius {
 
   template<typename B>
   bool Graph<B>::addLang(B* branch, const std::string& lang, const std::string& name)
+  {
+    std::lock_guard<std::shared_timed_mutex> lock(this->mutex_);
+    return addLangUnsafe(branch, lang, name);
+  }
+
+  template<typename B>
+  bool Graph<B>::addLangUnsafe(const std::string& branch_str, const std::string& lang, const std::string& name)
+  {
+    return addLangUnsafe(findBranch(branch_str), lang, name);
+  }
+
+  template<typename B>
+  bool Graph<B>::addLangUnsafe(B* branch, const std::string& lang, const std::string& name)
   {
     if(branch != nullptr)
     {
-      std::lock_guard<std::shared_timed_mutex> lock(this->mutex_);
       branch->setSteadyDictionary(lang.substr(1), name);
-      branch->updated_ = true;
+      labels_.update(branch);
+      setUpdated(branch);
       return true;
     }
     else
@@ -414,16 +550,33 @@ namespace ontologenius {
 
   template<typename B>
   bool Graph<B>::removeLang(B* branch, const std::string& lang, const std::string& name)
+  {
+    std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    return removeLangUnsafe(branch, lang, name);
+  }
+
+  template<typename B>
+  bool Graph<B>::removeLangUnsafe(const std::string& branch_str, const std::string& lang, const std::string& name)
+  {
+    return removeLangUnsafe(findBranch(branch_str), lang, name);
+  }
+
+  template<typename B>
+  bool Graph<B>::removeLangUnsafe(B* branch, const std::string& lang, const std::string& name)
   {
     if(branch != nullptr)
     {
-      std::lock_guard<std::shared_timed_mutex> lock(mutex_);
-
       auto lang_id = lang.substr(1);
-      removeFromDictionary(branch->dictionary_.spoken_, lang_id, name);
-      removeFromDictionary(branch->dictionary_.muted_, lang_id, name);
-      removeFromDictionary(branch->steady_dictionary_.spoken_, lang_id, name);
-      removeFromDictionary(branch->steady_dictionary_.muted_, lang_id, name);
+      branch->dictionary_.spoken_.remove(lang_id, name);
+      branch->dictionary_.muted_.remove(lang_id, name);
+      bool removed = branch->steady_dictionary_.spoken_.remove(lang_id, name);
+      removed = branch->steady_dictionary_.muted_.remove(lang_id, name) || removed;
+      if(removed)
+      {
+        branch->flags_.erase("dico"); // the labels derived from it have to be removed
+        setUpdated(branch);
+      }
+      labels_.update(branch);
 
       return true;
     }
@@ -440,32 +593,29 @@ namespace ontologenius {
 
     if(branch != nullptr)
     {
-      if(branch->dictionary_.spoken_.find(language_) != branch->dictionary_.spoken_.end())
-      {
-        if(branch->dictionary_.spoken_[language_].empty() == false)
+      // names with an underscore are only given if there is no other
+      size_t nb_names = 0;
+      size_t nb_candidates = 0;
+      branch->dictionary_.spoken_.forEach(language_, [&nb_names, &nb_candidates](const std::string& name) {
+        nb_names++;
+        if(name.find('_') == std::string::npos)
+          nb_candidates++;
+      });
+
+      if(nb_names == 0)
+        return use_default ? branch->value() : "";
+
+      std::string res;
+      size_t candidate = deterministic_names_ ? 0 : ((nb_candidates == 0) ? 0 : getRandomIndex(nb_candidates));
+      branch->dictionary_.spoken_.forEach(language_, [&res, &candidate, nb_candidates](const std::string& name) {
+        if((nb_candidates == 0) || (name.find('_') == std::string::npos))
         {
-          std::unordered_set<size_t> tested;
-          std::random_device rd;
-          std::mt19937 gen(rd());
-
-          size_t dic_size = branch->dictionary_.spoken_[language_].size();
-          std::uniform_int_distribution<> dis(0, (int)dic_size - 1);
-
-          while(tested.size() < dic_size)
-          {
-            size_t rand_index = dis(gen);
-            std::string word = branch->dictionary_.spoken_[language_][rand_index];
-            if(word.find('_') == std::string::npos)
-              return word;
-            tested.insert(rand_index);
-          }
-          return branch->dictionary_.spoken_[language_][0];
+          if(candidate == 0)
+            res = name;
+          candidate--;
         }
-        else if(use_default)
-          return branch->value();
-      }
-      else if(use_default)
-        return branch->value();
+      });
+      return res;
     }
 
     return "";
@@ -481,9 +631,8 @@ namespace ontologenius {
     std::vector<std::string> res;
     if(branch != nullptr)
     {
-      if(branch->dictionary_.spoken_.find(language_) != branch->dictionary_.spoken_.end())
-        res = branch->dictionary_.spoken_[language_];
-      else if(use_default)
+      branch->dictionary_.spoken_.forEach(language_, [&res](const std::string& name) { res.push_back(name); });
+      if(res.empty() && use_default)
         res.push_back(branch->value());
     }
 
@@ -500,101 +649,23 @@ namespace ontologenius {
     std::vector<std::string> res;
     if(branch != nullptr)
     {
-      if(branch->dictionary_.spoken_.find(language_) != branch->dictionary_.spoken_.end())
-        res = branch->dictionary_.spoken_[language_];
-      else if(use_default)
+      branch->dictionary_.spoken_.forEach(language_, [&res](const std::string& name) { res.push_back(name); });
+      if(res.empty() && use_default)
         res.push_back(branch->value());
 
-      if(branch->dictionary_.muted_.find(language_) != branch->dictionary_.muted_.end())
-      {
-        std::vector<std::string> muted = branch->dictionary_.muted_[language_];
-        res.insert(res.end(), muted.begin(), muted.end());
-      }
+      branch->dictionary_.muted_.forEach(language_, [&res](const std::string& name) { res.push_back(name); });
     }
 
     return res;
   }
 
-  template<typename D>
-  bool fullComparator(D* branch, const std::string& value, const std::string& lang, bool use_default)
-  {
-    if(use_default)
-      if(branch->value() == value)
-        return true;
-
-    if(branch->dictionary_.spoken_.find(lang) != branch->dictionary_.spoken_.end())
-      if(std::any_of(branch->dictionary_.spoken_[lang].begin(), branch->dictionary_.spoken_[lang].end(), [value](auto& word) { return word == value; }))
-        return true;
-
-    if(branch->dictionary_.muted_.find(lang) != branch->dictionary_.muted_.end())
-      if(std::any_of(branch->dictionary_.muted_[lang].begin(), branch->dictionary_.muted_[lang].end(), [value](auto& word) { return word == value; }))
-        return true;
-
-    return false;
-  }
-
-  template<typename D>
-  bool comparator(D* branch, const std::string& value, const std::string& lang, bool use_default)
-  {
-    std::smatch match;
-
-    if(use_default)
-    {
-      std::regex regex("\\b(" + branch->value() + ")([^ ]*)");
-      if(std::regex_search(value, match, regex))
-        return true;
-    }
-
-    if(branch->dictionary_.spoken_.find(lang) != branch->dictionary_.spoken_.end())
-      for(auto& word : branch->dictionary_.spoken_[lang])
-      {
-        std::regex regex("\\b(" + word + ")([^ ]*)");
-        if(std::regex_search(value, match, regex))
-          return true;
-      }
-
-    if(branch->dictionary_.muted_.find(lang) != branch->dictionary_.muted_.end())
-      for(auto& word : branch->dictionary_.muted_[lang])
-      {
-        std::regex regex("\\b(" + word + ")([^ ]*)");
-        if(std::regex_search(value, match, regex))
-          return true;
-      }
-    return false;
-  }
-
-  template<typename D>
-  bool comparatorRegex(D* branch, const std::string& regex, const std::string& lang, bool use_default)
-  {
-    std::regex base_regex(regex);
-    std::smatch match;
-
-    if(use_default)
-    {
-      const std::string& tmp = branch->value();
-      if(std::regex_match(tmp, match, base_regex))
-        return true;
-    }
-
-    if(branch->dictionary_.spoken_.find(lang) != branch->dictionary_.spoken_.end())
-      for(auto& word : branch->dictionary_.spoken_[lang])
-        if(std::regex_match(word, match, base_regex))
-          return true;
-
-    if(branch->dictionary_.muted_.find(lang) != branch->dictionary_.muted_.end())
-      for(auto& word : branch->dictionary_.muted_[lang])
-        if(std::regex_match(word, match, base_regex))
-          return true;
-    return false;
-  }
-
   template<typename B>
   template<typename T>
   std::unordered_set<T> Graph<B>::find(const std::string& value, bool use_default)
   {
     std::unordered_set<T> res;
     std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    std::vector<B*> branchs = this->container_.find(&fullComparator<B>, value, language_, use_default);
+    std::vector<B*> branchs = labels_.find(value, language_, use_default, all_branchs_);
     for(auto& branch : branchs)
       insert(res, branch);
 
@@ -607,7 +678,7 @@ namespace ontologenius {
   {
     std::unordered_set<T> res;
     std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    std::vector<B*> branchs = this->container_.find(&comparator<B>, value, language_, use_default);
+    std::vector<B*> branchs = labels_.findSub(value, language_, use_default, all_branchs_);
     for(auto& branch : branchs)
       insert(res, branch);
 
@@ -619,8 +690,18 @@ namespace ontologenius {
   std::unordered_set<T> Graph<B>::findRegex(const std::string& regex, bool use_default)
   {
     std::unordered_set<T> res;
+    std::regex base_regex;
+    try
+    {
+      base_regex = std::regex(regex, std::regex::optimize);
+    }
+    catch(std::regex_error& e)
+    {
+      return res;
+    }
+
     std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    std::vector<B*> branchs = this->container_.find(&comparatorRegex<B>, regex, language_, use_default);
+    std::vector<B*> branchs = labels_.findRegex(base_regex, LabelIndex<B>::getLiteralPrefix(regex), language_, use_default, all_branchs_);
     for(auto& branch : branchs)
       insert(res, branch);
 
@@ -630,55 +711,8 @@ namespace ontologenius {
   template<typename B>
   std::unordered_set<std::string> Graph<B>::findFuzzy(const std::string& value, bool use_default, double threshold)
   {
-    double lower_cost = 100000;
-    double tmp_cost = NAN;
-    std::unordered_set<std::string> res;
-
-    LevenshteinDistance dist;
-
     std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    for(auto* branch : this->all_branchs_)
-    {
-      if(use_default)
-        if((tmp_cost = dist.get(branch->value(), value)) <= lower_cost)
-        {
-          if(tmp_cost != lower_cost)
-          {
-            lower_cost = tmp_cost;
-            res.clear();
-          }
-          res.insert(branch->value());
-        }
-
-      if(branch->dictionary_.spoken_.find(language_) != branch->dictionary_.spoken_.end())
-        for(auto& word : branch->dictionary_.spoken_[language_])
-          if((tmp_cost = dist.get(word, value)) <= lower_cost)
-          {
-            if(tmp_cost != lower_cost)
-            {
-              lower_cost = tmp_cost;
-              res.clear();
-            }
-            res.insert(word);
-          }
-
-      if(branch->dictionary_.muted_.find(language_) != branch->dictionary_.muted_.end())
-        for(auto& word : branch->dictionary_.muted_[language_])
-          if((tmp_cost = dist.get(word, value)) <= lower_cost)
-          {
-            if(tmp_cost != lower_cost)
-            {
-              lower_cost = tmp_cost;
-              res.clear();
-            }
-            res.insert(word);
-          }
-    }
-
-    if(lower_cost > threshold)
-      res.clear();
-
-    return res;
+    return labels_.findFuzzy(value, language_, use_default, threshold, all_branchs_);
   }
 
 } // namespace ontologenius
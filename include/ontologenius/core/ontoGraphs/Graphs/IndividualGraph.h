@@ -8,6 +8,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "ontologenius/core/ontoGraphs/BranchContainer/PropertyRelationIndex.h"
 #include "ontologenius/core/ontoGraphs/Branchs/IndividualBranch.h"
 #include "ontologenius/core/ontoGraphs/Graphs/Graph.h"
 
@@ -41,8 +42,8 @@ namespace ontologenius {
     friend AnonymousGraph;
 
   public:
-    IndividualGraph(ClassGraph* class_graph, ObjectPropertyGraph* object_property_graph, DataPropertyGraph* data_property_graph);
-    IndividualGraph(const IndividualGraph& other, ClassGraph* class_graph, ObjectPropertyGraph* object_property_graph, DataPropertyGraph* data_property_graph);
+    IndividualGraph(ClassGraph* class_graph, ObjectPropertyGraph* object_property_graph, DataPropertyGraph* data_property_graph, WordTable* table);
+    IndividualGraph(const IndividualGraph& other, ClassGraph* class_graph, ObjectPropertyGraph* object_property_graph, DataPropertyGraph* data_property_graph, WordTable* table);
     ~IndividualGraph() override = default;
 
     void deepCopy(const IndividualGraph& other);
@@ -98,28 +99,41 @@ namespace ontologenius {
     std::vector<std::string> getInferenceExplanation(const std::string& param);
     std::vector<std::string> getInferenceExplanationIndex(const std::string& param);
 
-    ClassBranch* upgradeToBranch(IndividualBranch* indiv);
+    ClassBranch* upgradeToBranch(IndividualBranch* indiv); // both the individual and class graphs must be locked
     IndividualBranch* findOrCreateBranchSafe(const std::string& name);
-    IndividualBranch* findOrCreateBranch(const std::string& name);
+    // The Unsafe variants expect the individual, class and property graphs to be locked by the caller
     void deleteIndividual(IndividualBranch* indiv);
+    void deleteIndividualUnsafe(IndividualBranch* indiv);
     void redirectDeleteIndividual(IndividualBranch* indiv, ClassBranch* class_branch);
+    void redirectDeleteIndividualUnsafe(IndividualBranch* indiv, ClassBranch* class_branch);
     bool addInheritage(const std::string& indiv, const std::string& class_inherited);
+    bool addInheritageUnsafe(const std::string& indiv, const std::string& class_inherited);
     bool addInheritage(IndividualBranch* branch, const std::string& class_inherited);
     bool addInheritageUnsafe(IndividualBranch* branch, const std::string& class_inherited);
     bool addInheritageInvert(const std::string& indiv, const std::string& class_inherited);
+    bool addInheritageInvertUnsafe(const std::string& indiv, const std::string& class_inherited);
     bool addInheritageInvertUpgrade(const std::string& indiv, const std::string& class_inherited);
+    bool addInheritageInvertUpgradeUnsafe(const std::string& indiv, const std::string& class_inherited);
     int addRelation(IndividualBranch* indiv_from, ObjectPropertyBranch* property, IndividualBranch* indiv_on, double proba = 1.0, bool inferred = false, bool check_existance = true);
     int addRelation(IndividualBranch* indiv_from, DataPropertyBranch* property, LiteralNode* data, double proba = 1.0, bool inferred = false);
-    void addRelation(IndividualBranch* indiv_from, const std::string& property, const std::string& indiv_on);
-    void addRelation(IndividualBranch* indiv_from, const std::string& property, const std::string& type, const std::string& data);
-    void addRelationInvert(const std::string& indiv_from, const std::string& property, IndividualBranch* indiv_on);
+    void addRelation(IndividualBranch* indiv_from, const std::string& property, const std::string& indiv_on, double proba = 1.0);
+    void addRelation(IndividualBranch* indiv_from, const std::string& property, const std::string& type, const std::string& data, double proba = 1.0);
+    void addRelationUnsafe(IndividualBranch* indiv_from, const std::string& property, const std::string& indiv_on, double proba = 1.0);
+    void addRelationUnsafe(IndividualBranch* indiv_from, const std::string& property, const std::string& type, const std::string& data, double proba = 1.0);
+    void addRelationInvert(const std::string& indiv_from, const std::string& property, IndividualBranch* indiv_on, double proba = 1.0);
+    void addRelationInvertUnsafe(const std::string& indiv_from, const std::string& property, IndividualBranch* indiv_on, double proba = 1.0);
     std::vector<std::pair<std::string, std::string>> removeInheritage(const std::string& indiv, const std::string& class_inherited);
+    std::vector<std::pair<std::string, std::string>> removeInheritageUnsafe(const std::string& indiv, const std::string& class_inherited);
     bool removeInheritage(IndividualBranch* indiv, ClassBranch* class_branch, std::vector<std::pair<std::string, std::string>>& explanations, bool protect_stated = false);
     void addSameAs(const std::string& indiv_1, const std::string& indiv_2);
+    void addSameAsUnsafe(const std::string& indiv_1, const std::string& indiv_2);
     std::vector<std::pair<std::string, std::string>> removeSameAs(const std::string& indiv_1, const std::string& indiv_2, bool protect_stated = false);
+    std::vector<std::pair<std::string, std::string>> removeSameAsUnsafe(const std::string& indiv_1, const std::string& indiv_2, bool protect_stated = false);
     std::pair<std::vector<std::pair<std::string, std::string>>, bool> removeRelation(IndividualBranch* branch_from, ObjectPropertyBranch* property, IndividualBranch* branch_on, bool protect_stated = false);
     std::vector<std::pair<std::string, std::string>> removeRelation(const std::string& indiv_from, const std::string& property, const std::string& indiv_on);
+    std::vector<std::pair<std::string, std::string>> removeRelationUnsafe(const std::string& indiv_from, const std::string& property, const std::string& indiv_on);
     std::vector<std::pair<std::string, std::string>> removeRelation(const std::string& indiv_from, const std::string& property, const std::string& type, const std::string& data);
+    std::vector<std::pair<std::string, std::string>> removeRelationUnsafe(const std::string& indiv_from, const std::string& property, const std::string& type, const std::string& data);
     std::vector<std::pair<std::string, std::string>> removeRelationInverse(IndividualBranch* indiv_from, ObjectPropertyBranch* property, IndividualBranch* indiv_on);
     std::vector<std::pair<std::string, std::string>> removeRelationSymetric(IndividualBranch* indiv_from, ObjectPropertyBranch* property, IndividualBranch* indiv_on);
     template<typename T, typename C>
@@ -133,24 +147,17 @@ namespace ontologenius {
     void getLowestSame(IndividualBranch* individual, std::unordered_set<index_t>& res);
     void getSame(IndividualBranch* individual, std::unordered_set<index_t>& res);
 
+    // follows the changes of the property taxonomy in the relation indexes
+    void updateRelationIndexesUnsafe();
+
+    PropertyRelationIndex<IndividualBranch, IndividualBranch, ObjectPropertyGraph> object_relations_index_;
+    PropertyRelationIndex<IndividualBranch, LiteralNode, DataPropertyGraph> data_relations_index_;
+
   private:
     ClassGraph* class_graph_;
     ObjectPropertyGraph* object_property_graph_;
     DataPropertyGraph* data_property_graph_;
 
-    std::vector<IndividualBranch*> ordered_individuals_; // contains the individuals ordered wrt their index
-                                                         // unused indexes have nullptr in
-
-    IndividualBranch* getIndividualByIndex(index_t index)
-    {
-      if(index <= 0)
-        return nullptr;
-      else if(index <= (index_t)ordered_individuals_.size())
-        return ordered_individuals_[index];
-      else
-        return nullptr;
-    }
-
     template<typename T>
     std::unordered_set<T> getDistincts(IndividualBranch* individual);
     template<typename T>
@@ -212,8 +219,10 @@ namespace ontologenius {
     bool checkRangeAndDomain(IndividualBranch* from, DataPropertyBranch* prop, LiteralNode* data);
 
     void cpyBranch(IndividualBranch* old_branch, IndividualBranch* new_branch);
-    void insertBranchInVectors(IndividualBranch* branch);
-    void removeBranchInVectors(size_t vector_index);
+
+    void eraseRelationsOn(IndividualBranch* indiv);
+    void indexObjectRelation(IndividualBranch* indiv_from, ObjectPropertyBranch* property, IndividualBranch* indiv_on);
+    void eraseObjectRelation(IndividualBranch* branch, size_t relation_index);
   };
 
   template<typename T, typename C>
@@ -227,7 +236,7 @@ namespace ontologenius {
 
     for(size_t i = 0; i < relations.has_induced_object_relations[relation_index]->triplets.size();)
     {
-      auto& triplet = relations.has_induced_object_relations[relation_index]->triplets[i];
+      auto triplet = relations.has_induced_object_relations[relation_index]->triplets[i]; // copied as erased by the removal
       auto tmp = removeRelation(triplet.subject,
                                 triplet.predicate,
                                 triplet.object,
@@ -246,7 +255,7 @@ namespace ontologenius {
 
     for(size_t i = 0; i < relations.has_induced_inheritance_relations[relation_index]->triplets.size();)
     {
-      auto& triplet = relations.has_induced_inheritance_relations[relation_index]->triplets[i];
+      auto triplet = relations.has_induced_inheritance_relations[relation_index]->triplets[i]; // copied as erased by the removal
 
       std::vector<std::pair<std::string, std::string>> tmp;
       if(removeInheritage(triplet.subject, triplet.object, tmp, true))
@@ -273,7 +282,7 @@ namespace ontologenius {
 
     for(size_t i = 0; i < relations.has_induced_object_relations[relation_index]->triplets.size();)
     {
-      auto& triplet = relations.has_induced_object_relations[relation_index]->triplets[i];
+      auto triplet = relations.has_induced_object_relations[relation_index]->triplets[i]; // copied as erased by the removal
       auto tmp = removeRelation(triplet.subject,
                                 triplet.predicate,
                                 triplet.object,
@@ -292,7 +301,7 @@ namespace ontologenius {
 
     for(size_t i = 0; i < relations.has_induced_inheritance_relations[relation_index]->triplets.size();)
     {
-      auto& triplet = relations.has_induced_inheritance_relations[relation_index]->triplets[i];
+      auto triplet = relations.has_induced_inheritance_relations[relation_index]->triplets[i]; // copied as erased by the removal
 
       std::vector<std::pair<std::string, std::string>> tmp;
       if(removeInheritage(triplet.subject, triplet.object, tmp, true))
@@ -45,8 +45,8 @@ namespace ontologenius {
     friend AnonymousClassGraph;
 
   public:
-    explicit ObjectPropertyGraph(IndividualGraph* individual_graph, ClassGraph* class_graph);
-    ObjectPropertyGraph(const ObjectPropertyGraph& other, IndividualGraph* individual_graph, ClassGraph* class_graph);
+    ObjectPropertyGraph(IndividualGraph* individual_graph, ClassGraph* class_graph, WordTable* table);
+    ObjectPropertyGraph(const ObjectPropertyGraph& other, IndividualGraph* individual_graph, ClassGraph* class_graph, WordTable* table);
     ~ObjectPropertyGraph() override = default;
 
     void deepCopy(const ObjectPropertyGraph& other);
@@ -65,7 +65,9 @@ namespace ontologenius {
     void getDomainAndRangePtr(ObjectPropertyBranch* branch, std::unordered_set<ClassBranch*>& domains, std::unordered_set<ClassBranch*>& ranges, size_t depth = -1);
 
     bool addInverseOf(const std::string& from, const std::string& on);
+    bool addInverseOfUnsafe(const std::string& from, const std::string& on);
     bool removeInverseOf(const std::string& from, const std::string& on);
+    bool removeInverseOfUnsafe(const std::string& from, const std::string& on);
 
     bool isIrreflexive(const std::string& prop);
     bool isIrreflexive(ObjectPropertyBranch* prop);
@@ -1,9 +1,14 @@
 #ifndef ONTOLOGENIUS_ONTOGRAPH_H
 #define ONTOLOGENIUS_ONTOGRAPH_H
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <map>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -24,7 +29,7 @@ namespace ontologenius {
     static_assert(std::is_base_of<Branch<B>, B>::value, "B must be derived from Branch<B>");
 
   public:
-    explicit OntoGraph(IndividualGraph* individual_graph) : individual_graph_(individual_graph) {}
+    OntoGraph(IndividualGraph* individual_graph, WordTable* table) : Graph<B>(table), individual_graph_(individual_graph) {}
     ~OntoGraph() override = default;
 
     template<typename T>
@@ -67,26 +72,47 @@ namespace ontologenius {
     B* isDisjoint(const std::unordered_set<B*>& set_base, const std::unordered_set<B*>& ups);
 
     bool addInheritage(const std::string& branch_base, const std::string& branch_inherited);
+    bool addInheritageUnsafe(const std::string& branch_base, const std::string& branch_inherited);
     bool addInheritage(B* branch, B* inherited);
     std::vector<std::pair<std::string, std::string>> removeInheritage(const std::string& branch_base, const std::string& branch_inherited);
+    std::vector<std::pair<std::string, std::string>> removeInheritageUnsafe(const std::string& branch_base, const std::string& branch_inherited);
     std::vector<std::pair<std::string, std::string>> removeInheritage(B* branch, B* inherited);
     bool removeInheritage(IndividualBranch* indiv, ClassBranch* class_branch, std::vector<std::pair<std::string, std::string>>& explanations);
 
+    // The full ancestors of the branches are cached on first use, the descendants are not
+    // as they would cost a quadratic memory on wide taxonomies.
+    // addInheritage and removeInheritage keep the cache up to date,
+    // any other modification of mothers_ or childs_ has to invalidate it.
+    void invalidateClosure();
+    void invalidateClosure(B* branch);
+    // incremented each time the closure is invalidated, that is on each change of the taxonomy
+    size_t getHierarchyVersion() const { return hierarchy_version_; }
+
     template<typename T>
     std::unordered_set<T> select(const std::unordered_set<T>& on, const T& selector)
     {
       std::unordered_set<T> res;
       std::shared_lock<std::shared_timed_mutex> lock(Graph<B>::mutex_);
 
+      B* selector_branch = this->findBranch(selector);
+      if(selector_branch == nullptr)
+        return res;
+
       for(auto& it : on)
       {
-        std::unordered_set<T> tmp = getUp(it);
-        if(tmp.find(selector) != tmp.end())
-          res.insert(it);
+        B* branch = this->findBranch(it);
+        if(branch == nullptr)
+          continue;
+
+        upClosure(branch, [&](const std::unordered_set<B*>& ups) {
+          if(ups.find(selector_branch) != ups.end())
+            res.insert(it);
+        });
       }
       return res;
     }
 
+    // the caller has to hold the individual graph exclusively, before this graph
     template<typename T>
     std::vector<std::pair<std::string, std::string>> removeInductions(B* indiv_from, RelationsWithInductions<SingleElement<T>>& relations, size_t relation_index, const std::string& property)
     {
@@ -97,7 +123,7 @@ namespace ontologenius {
 
       for(size_t i = 0; i < relations.has_induced_object_relations[relation_index]->triplets.size();)
       {
-        auto& triplet = relations.has_induced_object_relations[relation_index]->triplets[i];
+        auto triplet = relations.has_induced_object_relations[relation_index]->triplets[i]; // copied as erased by the removal
         auto tmp = individual_graph_->removeRelation(triplet.subject,
                                                      triplet.predicate,
                                                      triplet.object,
@@ -116,12 +142,11 @@ namespace ontologenius {
 
       for(size_t i = 0; i < relations.has_induced_inheritance_relations[relation_index]->triplets.size();)
       {
-        auto& triplet = relations.has_induced_inheritance_relations[relation_index]->triplets[i];
+        auto triplet = relations.has_induced_inheritance_relations[relation_index]->triplets[i]; // copied as erased by the removal
 
         // DO it on object relations
 
         std::vector<std::pair<std::string, std::string>> tmp;
-        std::lock_guard<std::shared_timed_mutex> lock(individual_graph_->mutex_);
         if(individual_graph_->removeInheritage(triplet.subject, triplet.object, tmp, true))
         {
           explanations.emplace_back("[DEL]" + triplet.subject->value() + "|isA|" +
@@ -142,6 +167,24 @@ namespace ontologenius {
     void amIA(B** me, std::map<std::string, B*>& vect, const std::string& value, bool erase = true);
 
     void mitigate(B* branch);
+
+  private:
+    // closures are evicted once the cache holds more ancestors than that
+    static constexpr size_t closures_limit = 1 << 20;
+
+    std::atomic<size_t> hierarchy_version_{0};
+
+    std::shared_timed_mutex closure_mutex_; // only taken last, protects the closures below
+    std::unordered_map<B*, std::unordered_set<B*>> up_closures_;
+    size_t up_closures_size_ = 0;
+
+    // Calls visitor with the ancestors of branch. A cached closure is visited under a shared lock
+    // of the cache, a missing one is computed without it and then stored under an exclusive lock.
+    // The visitor must not use the cache.
+    template<typename F>
+    void upClosure(B* branch, F visitor);
+    // not cached, only the lock of the graph is needed
+    void downClosure(B* branch, std::unordered_set<B*>& res);
   };
 
   template<typename B>
@@ -231,10 +274,18 @@ namespace ontologenius {
   template<typename T>
   bool OntoGraph<B>::existInInheritance(B* branch, const T& selector)
   {
-    if(this->compare(branch, selector))
+    if(branch == nullptr)
+      return false;
+    else if(this->compare(branch, selector))
       return true;
-    else
-      return std::any_of(branch->mothers_.begin(), branch->mothers_.end(), [selector, this](const auto& mother) { return this->existInInheritance(mother.elem, selector); });
+
+    B* selector_branch = this->findBranch(selector);
+    if(selector_branch == nullptr)
+      return false;
+
+    bool res = false;
+    upClosure(branch, [&res, selector_branch](const std::unordered_set<B*>& ups) { res = (ups.find(selector_branch) != ups.end()); });
+    return res;
   }
 
   template<typename B>
@@ -249,7 +300,14 @@ namespace ontologenius {
   template<typename T>
   void OntoGraph<B>::getDown(B* branch, std::unordered_set<T>& res, int depth, unsigned int current_depth)
   {
-    if(current_depth <= (unsigned int)depth)
+    if((depth < 0) && (current_depth == 0))
+    {
+      std::unordered_set<B*> downs;
+      downClosure(branch, downs);
+      for(auto* down : downs)
+        this->insert(res, down);
+    }
+    else if(current_depth <= (unsigned int)depth)
     {
       current_depth++;
       if(this->insert(res, branch))
@@ -270,7 +328,14 @@ namespace ontologenius {
   template<typename T>
   void OntoGraph<B>::getUp(B* branch, std::unordered_set<T>& res, int depth, unsigned int current_depth)
   {
-    if(current_depth <= (unsigned int)depth)
+    if((depth < 0) && (current_depth == 0))
+    {
+      upClosure(branch, [this, &res](const std::unordered_set<B*>& ups) {
+        for(auto* up : ups)
+          this->insert(res, up);
+      });
+    }
+    else if(current_depth <= (unsigned int)depth)
     {
       current_depth++;
 
@@ -292,7 +357,9 @@ namespace ontologenius {
   template<typename B>
   void OntoGraph<B>::getDownPtr(B* branch, std::unordered_set<B*>& res, int depth, unsigned int current_depth)
   {
-    if(current_depth <= (unsigned int)depth)
+    if((depth < 0) && (current_depth == 0))
+      getDownPtr(branch, res);
+    else if(current_depth <= (unsigned int)depth)
     {
       current_depth++;
       if(res.insert(branch).second)
@@ -304,9 +371,7 @@ namespace ontologenius {
   template<typename B>
   void OntoGraph<B>::getDownPtr(B* branch, std::unordered_set<B*>& res)
   {
-    if(res.insert(branch).second)
-      for(auto& it : branch->childs_)
-        getDownPtr(it.elem, res);
+    downClosure(branch, res);
   }
 
   template<typename B>
@@ -322,7 +387,9 @@ namespace ontologenius {
   template<typename B>
   void OntoGraph<B>::getUpPtr(B* branch, std::unordered_set<B*>& res, int depth, unsigned int current_depth)
   {
-    if(current_depth < (unsigned int)depth)
+    if((depth < 0) && (current_depth == 0))
+      getUpPtr(branch, res);
+    else if(current_depth < (unsigned int)depth)
     {
       current_depth++;
       if(res.insert(branch).second)
@@ -336,9 +403,7 @@ namespace ontologenius {
   template<typename B>
   void OntoGraph<B>::getUpPtr(B* branch, std::unordered_set<B*>& res)
   {
-    if(res.insert(branch).second)
-      for(auto& it : branch->mothers_)
-        getUpPtr(it.elem, res);
+    upClosure(branch, [&res](const std::unordered_set<B*>& ups) { res.insert(ups.begin(), ups.end()); });
   }
 
   template<typename B>
@@ -410,7 +475,13 @@ namespace ontologenius {
   template<typename B>
   bool OntoGraph<B>::addInheritage(const std::string& branch_base, const std::string& branch_inherited)
   {
-    std::shared_lock<std::shared_timed_mutex> lock(Graph<B>::mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock(Graph<B>::mutex_);
+    return addInheritageUnsafe(branch_base, branch_inherited);
+  }
+
+  template<typename B>
+  bool OntoGraph<B>::addInheritageUnsafe(const std::string& branch_base, const std::string& branch_inherited)
+  {
     B* branch = this->findOrCreateBranch(branch_base);
     if(branch != nullptr)
     {
@@ -429,14 +500,15 @@ namespace ontologenius {
     {
       this->conditionalPushBack(branch->mothers_, SingleElement<B*>(inherited));
       this->conditionalPushBack(inherited->childs_, SingleElement<B*>(branch));
-      branch->updated_ = true;
-      inherited->updated_ = true;
+      this->setUpdated(branch);
+      this->setUpdated(inherited);
+      invalidateClosure(branch);
       mitigate(branch);
 
       std::unordered_set<B*> downs;
       getDownPtr(branch, downs);
       for(auto* down : downs)
-        down->updated_ = true; // propagate update
+        this->setUpdated(down); // propagate update
 
       return true; // TODO verify that multi inheritances are compatible
     }
@@ -447,8 +519,17 @@ namespace ontologenius {
   template<typename B>
   std::vector<std::pair<std::string, std::string>> OntoGraph<B>::removeInheritage(const std::string& branch_base, const std::string& branch_inherited)
   {
-    B* branch_base_ptr = this->findBranchSafe(branch_base);
-    B* branch_inherited_ptr = this->findBranchSafe(branch_inherited);
+    // same locking order as the individual graph queries, the inductions being removed from it
+    const std::lock_guard<std::shared_timed_mutex> lock_indiv(individual_graph_->mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock(this->mutex_);
+    return removeInheritageUnsafe(branch_base, branch_inherited);
+  }
+
+  template<typename B>
+  std::vector<std::pair<std::string, std::string>> OntoGraph<B>::removeInheritageUnsafe(const std::string& branch_base, const std::string& branch_inherited)
+  {
+    B* branch_base_ptr = this->findBranch(branch_base);
+    B* branch_inherited_ptr = this->findBranch(branch_inherited);
 
     if(branch_base_ptr == nullptr)
     {
@@ -459,7 +540,6 @@ namespace ontologenius {
       throw GraphException("The concept " + branch_inherited + " does not exist");
     }
 
-    std::lock_guard<std::shared_timed_mutex> lock(this->mutex_);
     return removeInheritage(branch_base_ptr, branch_inherited_ptr);
   }
 
@@ -475,8 +555,9 @@ namespace ontologenius {
         branch->mothers_.erase(i);
 
         this->removeFromElemVect(inherited->childs_, branch);
-        branch->updated_ = true;
-        inherited->updated_ = true;
+        this->setUpdated(branch);
+        this->setUpdated(inherited);
+        invalidateClosure(branch);
         return explanations;
       }
     }
@@ -500,12 +581,13 @@ namespace ontologenius {
       }
     }
 
-    RelationsWithInductions<SingleElement<B*>>& mothers = branch->mothers_;
+    // work on a copy as removing a mother would shift the ones we iterate on
+    std::vector<SingleElement<B*>> mothers = branch->mothers_.relations;
     for(SingleElement<B*>& mother : mothers)
     {
       std::unordered_set<B*> down;
       getDownPtr(mother.elem, down);
-      std::vector<B*> inter = this->intersection(down, mothers.relations);
+      std::vector<B*> inter = this->intersection(down, branch->mothers_.relations);
       if(inter.size() > 1)
       {
         this->removeFromElemVect(branch->mothers_, mother.elem);
@@ -514,6 +596,108 @@ namespace ontologenius {
     }
   }
 
+  template<typename B>
+  void OntoGraph<B>::invalidateClosure()
+  {
+    hierarchy_version_++;
+    std::lock_guard<std::shared_timed_mutex> lock(closure_mutex_);
+    up_closures_.clear();
+    up_closures_size_ = 0;
+  }
+
+  // Adding or removing an inheritance of branch only changes the ancestors of its descendants
+  template<typename B>
+  void OntoGraph<B>::invalidateClosure(B* branch)
+  {
+    hierarchy_version_++;
+    std::lock_guard<std::shared_timed_mutex> lock(closure_mutex_);
+    if(up_closures_.empty())
+      return;
+
+    std::unordered_set<B*> downs;
+    downClosure(branch, downs);
+    for(auto* down : downs)
+    {
+      auto it = up_closures_.find(down);
+      if(it != up_closures_.end())
+      {
+        up_closures_size_ -= it->second.size();
+        up_closures_.erase(it);
+      }
+    }
+  }
+
+  template<typename B>
+  template<typename F>
+  void OntoGraph<B>::upClosure(B* branch, F visitor)
+  {
+    {
+      std::shared_lock<std::shared_timed_mutex> lock(closure_mutex_);
+      auto it = up_closures_.find(branch);
+      if(it != up_closures_.end())
+      {
+        visitor(it->second);
+        return;
+      }
+    }
+
+    const size_t version = hierarchy_version_;
+    std::unordered_set<B*> closure;
+    std::vector<B*> to_visit = {branch};
+    while(to_visit.empty() == false)
+    {
+      B* current = to_visit.back();
+      to_visit.pop_back();
+      if(closure.insert(current).second)
+        for(auto& mother : current->mothers_)
+          to_visit.push_back(mother.elem);
+    }
+    visitor(closure);
+
+    std::lock_guard<std::shared_timed_mutex> lock(closure_mutex_);
+    // an invalidation in the meantime could make it outdated
+    if((version != hierarchy_version_) || (closure.size() > closures_limit))
+      return;
+
+    // another reader may have filled it in the meantime
+    if(up_closures_.find(branch) != up_closures_.end())
+      return;
+
+    // evicts only what is needed for the new closure to fit
+    while((up_closures_size_ + closure.size() > closures_limit) && (up_closures_.empty() == false))
+    {
+      auto evicted = up_closures_.begin();
+      up_closures_size_ -= evicted->second.size();
+      up_closures_.erase(evicted);
+    }
+
+    up_closures_size_ += closure.size();
+    up_closures_.emplace(branch, std::move(closure));
+  }
+
+  template<typename B>
+  void OntoGraph<B>::downClosure(B* branch, std::unordered_set<B*>& res)
+  {
+    if(res.empty() == false)
+    {
+      // res can already hold a part of the descendants without their own descendants
+      std::unordered_set<B*> closure;
+      downClosure(branch, closure);
+      res.insert(closure.begin(), closure.end());
+      return;
+    }
+
+    std::vector<B*> to_visit = {branch};
+    while(to_visit.empty() == false)
+    {
+      B* current = to_visit.back();
+      to_visit.pop_back();
+      if(res.insert(current).second)
+        for(auto& child : current->childs_)
+          to_visit.push_back(child.elem);
+    }
+  }
+
 } // namespace ontologenius
 
 #endif // ONTOLOGENIUS_ONTOGRAPH_H
@@ -1,6 +1,8 @@
 #ifndef ONTOLOGENIUS_ONTOLOGY_H
 #define ONTOLOGENIUS_ONTOLOGY_H
 
+#include "ontologenius/core/ontoGraphs/Branchs/Explanation.h"
+#include "ontologenius/core/ontoGraphs/Branchs/WordTable.h"
 #include "ontologenius/core/ontoGraphs/Graphs/AnonymousClassGraph.h"
 #include "ontologenius/core/ontoGraphs/Graphs/ClassGraph.h"
 #include "ontologenius/core/ontoGraphs/Graphs/DataPropertyGraph.h"
@@ -28,9 +30,15 @@ namespace ontologenius {
     bool isInit(bool print = true) const;
     void setLanguage(const std::string& language);
     std::string getLanguage() const;
+    void setDeterministicNames(bool deterministic);
 
     void setDisplay(bool display);
 
+    // the tables have to be declared before the graphs as they must outlive their branches
+    WordTable table_;
+    WordTable literal_table_;
+    ExplanationTable explanation_table_;
+
     ClassGraph class_graph_;
     ObjectPropertyGraph object_property_graph_;
     DataPropertyGraph data_property_graph_;
@@ -43,6 +51,8 @@ namespace ontologenius {
 
     bool is_preloaded_;
     bool is_init_;
+
+    void copyInductions(const Ontology& other);
   };
 
 } // namespace ontologenius
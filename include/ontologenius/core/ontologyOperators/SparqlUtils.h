@@ -1,6 +1,7 @@
 #ifndef ONTOLOGENIUS_SPARQLUTILS_H
 #define ONTOLOGENIUS_SPARQLUTILS_H
 
+#include <algorithm>
 #include <map>
 #include <set>
 #include <string>
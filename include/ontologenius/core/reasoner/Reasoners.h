@@ -1,13 +1,16 @@
 #ifndef ONTOLOGENIUS_REASONERS_H
 #define ONTOLOGENIUS_REASONERS_H
 
+#include <cstddef>
 #include <map>
 #include <pluginlib/class_loader.hpp>
 #include <string>
+#include <vector>
 
 #include "ontologenius/core/ontoGraphs/Ontology.h"
 #include "ontologenius/core/reasoner/ConfigReader.h"
 #include "ontologenius/core/reasoner/plugins/ReasonerInterface.h"
+#include "ontologenius/core/utility/ThreadPool.h"
 
 namespace ontologenius {
 
@@ -30,7 +33,8 @@ namespace ontologenius {
     int deactivate(const std::string& plugin);
     std::string getDescription(const std::string& plugin);
 
-    void runPreReasoners(QueryOrigin_e origin, const std::string& action, const std::string& param);
+    // returns true if the ontology has been updated
+    bool runPreReasoners(QueryOrigin_e origin, const std::string& action, const std::string& param);
     void runPostReasoners();
     void runPeriodicReasoners();
 
@@ -62,14 +66,12 @@ namespace ontologenius {
     std::mutex explanations_mutex_;
 
     pluginlib::ClassLoader<ReasonerInterface> loader_;
+    ThreadPool pool_; // runs the independent post-reasoners concurrently
 
     void applyConfig();
+    std::vector<std::vector<size_t>> getPostReasoningWaves(const std::vector<ReasonerInterface*>& reasoners);
 
     void computeUpdates();
-    template<typename B>
-    void computeGraphUpdates(Graph<B>* graph);
-    void computeIndividualsUpdates();
-    void computeClassesUpdates();
     void computeIndividualsUpdatesPeriodic();
     void resetIndividualsUpdates();
 
@@ -15,6 +15,8 @@ namespace ontologenius {
     void setParameter(const std::string& name, const std::string& value) override;
 
     bool implementPostReasoning() override { return true; }
+    int getPostReasoningInputs() override { return change_inheritance | change_object_relation | change_data_relation; }
+    int getPostReasoningOutputs() override { return change_inheritance; }
 
     std::string getName() override;
     std::string getDescription() override;
@@ -23,6 +25,7 @@ namespace ontologenius {
 
   private:
     bool standard_mode_;
+    std::unordered_set<index_t> flagged_; // individuals having the equiv flag
 
     std::unordered_map<ClassBranch*, std::unordered_set<ClassBranch*>> disjoints_cache_;
 
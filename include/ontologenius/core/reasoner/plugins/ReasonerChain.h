@@ -16,6 +16,8 @@ namespace ontologenius {
     void postReason() override;
 
     bool implementPostReasoning() override { return true; }
+    int getPostReasoningInputs() override { return change_object_relation; }
+    int getPostReasoningOutputs() override { return change_object_relation; }
 
     std::string getName() override;
     std::string getDescription() override;
@@ -23,6 +25,8 @@ namespace ontologenius {
     bool defaultActive() override { return true; }
 
   private:
+    std::unordered_set<index_t> flagged_; // individuals having the chain flag
+
     void getUpPtrChain(ObjectPropertyBranch* branch, std::unordered_set<ObjectPropertyBranch*>& res);
 
     std::vector<std::pair<IndividualBranch*, UsedVector>> resolveChain(IndividualBranch* indiv, const std::vector<ObjectPropertyBranch*>& chain, size_t chain_index = 0);
@@ -1,6 +1,10 @@
 #ifndef ONTOLOGENIUS_REASONERDICTIONARY_H
 #define ONTOLOGENIUS_REASONERDICTIONARY_H
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "ontologenius/core/reasoner/plugins/ReasonerInterface.h"
 
 namespace ontologenius {
@@ -8,7 +12,7 @@ namespace ontologenius {
   class ReasonerDictionary : public ReasonerInterface
   {
   public:
-    ReasonerDictionary() : use_id_(false) {}
+    ReasonerDictionary() : use_id_(false), first_run_(true) {}
     ~ReasonerDictionary() override = default;
 
     void setParameter(const std::string& name, const std::string& value) override;
@@ -16,6 +20,8 @@ namespace ontologenius {
     void postReason() override;
 
     bool implementPostReasoning() override { return true; }
+    int getPostReasoningInputs() override { return change_label; }
+    int getPostReasoningOutputs() override { return change_label; }
 
     std::string getName() override;
     std::string getDescription() override;
@@ -23,14 +29,28 @@ namespace ontologenius {
     bool defaultActive() override { return true; }
 
   private:
+    // labels derived from a word
+    struct Derived_t
+    {
+      std::vector<std::string> spoken_;
+      std::vector<std::string> muted_;
+    };
+
     bool use_id_;
+    bool first_run_;
+    // derived labels of the words already met, shared by all the nodes
+    std::unordered_map<std::string, Derived_t> spoken_cache_;
+    std::unordered_map<std::string, Derived_t> muted_cache_;
+
+    bool updateDictionary(ValuedNode* node); // returns true if the dictionary has been updated
+    const Derived_t& getDerived(const std::string& word, bool spoken);
 
-    void updateDictionary(ValuedNode* node);
+    void split(std::vector<std::string>& spoken, std::vector<std::string>& muted);
+    void createLowerCase(std::vector<std::string>& spoken, std::vector<std::string>& muted);
+    void replaceQuote(std::vector<std::string>& spoken, std::vector<std::string>& muted);
 
-    void setId(ValuedNode* node);
-    void split(ValuedNode* node);
-    void createLowerCase(ValuedNode* node);
-    void replaceQuote(ValuedNode* node);
+    // adds the word to the words if it is neither in them nor in the others
+    static void addIfAbsent(const std::string& word, std::vector<std::string>& words, const std::vector<std::string>& others);
   };
 
 } // namespace ontologenius
@@ -2,6 +2,8 @@
 #define ONTOLOGENIUS_REASONERINTERFACE_H
 
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 #include "ontologenius/core/ontoGraphs/Ontology.h"
 #include "ontologenius/graphical/Display.h"
@@ -32,6 +34,17 @@ namespace ontologenius {
     query_origin_data_property,
   };
 
+  // Kinds of changes made onto the ontology, to be combined as flags
+  enum ReasonerChange_e
+  {
+    change_none = 0,
+    change_inheritance = 1 << 0,
+    change_object_relation = 1 << 1,
+    change_data_relation = 1 << 2,
+    change_label = 1 << 3,
+    change_all = change_inheritance | change_object_relation | change_data_relation | change_label
+  };
+
   struct QueryInfo_t
   {
     QueryType_e query_type;
@@ -92,13 +105,23 @@ namespace ontologenius {
     /// @return true if the reasoner implements periodic-reasoning
     virtual bool implementPeriodicReasoning() { return false; }
 
+    /// @brief This function can be overloaded for the post-reasoning to only be run again on relevant changes.
+    ///        Post-reasonings whose changes do not overlap can run concurrently,
+    ///        they thus have to lock the graphs they use.
+    /// @return the kinds of changes (ReasonerChange_e flags) the post-reasoning depends on
+    virtual int getPostReasoningInputs() { return change_all; }
+    /// @brief This function can be overloaded for the post-reasoning to only be run again on relevant changes
+    /// @return the kinds of changes (ReasonerChange_e flags) the post-reasoning can make
+    virtual int getPostReasoningOutputs() { return change_all; }
+
     virtual std::string getName() = 0;
     virtual std::string getDescription() = 0;
 
     virtual bool defaultActive() { return false; }
 
-    static size_t getNbUpdates() { return nb_update; }
-    static void resetNbUpdates() { nb_update = 0; }
+    // the updates are counted per reasoner as reasoners can run concurrently
+    size_t getNbUpdates() const { return nb_update; }
+    void resetNbUpdates() { nb_update = 0; }
 
     std::vector<std::pair<ReasonerNotificationStatus_e, std::string>> getNotifications()
     {
@@ -115,7 +138,16 @@ namespace ontologenius {
     }
 
   protected:
-    ReasonerInterface() : ontology_(nullptr) {}
+    ReasonerInterface() : ontology_(nullptr), nb_update(0), first_check_(true) {}
+
+    /// @brief Gives the individuals a post-reasoning has to check, rather than all of them.
+    ///        These are the updated individuals, or all of them on the first call
+    ///        or if a property has been updated.
+    std::vector<IndividualBranch*> getIndividualsToCheck();
+    /// @brief Same as above, with in addition the individuals still having the given flag.
+    /// @param flagged the indexes of the individuals flagged by the reasoner.
+    ///        The ones having lost the flag or no more existing are removed.
+    std::vector<IndividualBranch*> getIndividualsToCheck(const std::string& flag, std::unordered_set<index_t>& flagged);
 
     std::string agent_name_;
     Ontology* ontology_;
@@ -123,7 +155,12 @@ namespace ontologenius {
     std::vector<std::pair<ReasonerNotificationStatus_e, std::string>> notifications_;
     std::vector<std::pair<std::string, std::string>> explanations_;
 
-    static size_t nb_update;
+    size_t nb_update;
+
+  private:
+    bool first_check_;
+
+    bool checkAllIndividuals();
   };
 
 } // namespace ontologenius
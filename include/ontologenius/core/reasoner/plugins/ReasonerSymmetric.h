@@ -14,6 +14,8 @@ namespace ontologenius {
     void postReason() override;
 
     bool implementPostReasoning() override { return true; }
+    int getPostReasoningInputs() override { return change_object_relation; }
+    int getPostReasoningOutputs() override { return change_object_relation; }
 
     std::string getName() override;
     std::string getDescription() override;
@@ -17,6 +17,8 @@ namespace ontologenius {
     void postReason() override;
 
     bool implementPostReasoning() override { return true; }
+    int getPostReasoningInputs() override { return change_object_relation; }
+    int getPostReasoningOutputs() override { return change_object_relation; }
 
     std::string getName() override;
     std::string getDescription() override;
@@ -24,6 +26,8 @@ namespace ontologenius {
     bool defaultActive() override { return true; }
 
   private:
+    std::unordered_set<index_t> flagged_; // individuals having the transi flag
+
     void getUpPtrTransitive(ObjectPropertyBranch* branch, std::unordered_set<ObjectPropertyBranch*>& res);
     std::vector<std::pair<IndividualBranch*, UsedVector>> resolveChain(IndividualBranch* indiv, ObjectPropertyBranch* property, size_t current_length);
     void resolveChain(IndividualBranch* indiv, int same_index, ObjectPropertyBranch* property, size_t current_length, std::vector<std::pair<IndividualBranch*, UsedVector>>& res);
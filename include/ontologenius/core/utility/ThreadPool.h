@@ -0,0 +1,125 @@
+#ifndef ONTOLOGENIUS_THREADPOOL_H
+#define ONTOLOGENIUS_THREADPOOL_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ontologenius {
+
+  // Runs batches of tasks on threads only created once a batch needs them.
+  // The calling thread takes part to its batch and a batch is run at once.
+  class ThreadPool
+  {
+  public:
+    explicit ThreadPool(size_t max_threads = std::thread::hardware_concurrency()) : max_threads_(max_threads),
+                                                                                    nb_pending_(0),
+                                                                                    stop_(false)
+    {}
+
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+
+    ~ThreadPool()
+    {
+      {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      tasks_cv_.notify_all();
+      for(auto& worker : workers_)
+        worker.join();
+    }
+
+    // returns once all the tasks have been run, rethrowing the first exception of the tasks if any
+    void run(const std::vector<std::function<void()>>& tasks)
+    {
+      if((tasks.size() <= 1) || (max_threads_ <= 1))
+      {
+        for(const auto& task : tasks)
+          task();
+        return;
+      }
+
+      std::unique_lock<std::mutex> lock(mutex_);
+      const size_t nb_workers = std::min(tasks.size(), max_threads_) - 1;
+      while(workers_.size() < nb_workers)
+        workers_.emplace_back([this]() { work(); });
+
+      for(size_t i = 1; i < tasks.size(); i++)
+        tasks_.push_back(&tasks[i]);
+      nb_pending_ = tasks.size();
+      error_ = nullptr;
+      tasks_cv_.notify_all();
+
+      runTask(&tasks.front(), lock);
+      while(tasks_.empty() == false)
+      {
+        const auto* task = tasks_.front();
+        tasks_.pop_front();
+        runTask(task, lock);
+      }
+      done_cv_.wait(lock, [this]() { return nb_pending_ == 0; });
+
+      if(error_ != nullptr)
+        std::rethrow_exception(error_);
+    }
+
+  private:
+    size_t max_threads_;
+    std::vector<std::thread> workers_;
+    std::deque<const std::function<void()>*> tasks_;
+    size_t nb_pending_;
+    std::exception_ptr error_;
+    bool stop_;
+
+    std::mutex mutex_;
+    std::condition_variable tasks_cv_;
+    std::condition_variable done_cv_;
+
+    void work()
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while(true)
+      {
+        tasks_cv_.wait(lock, [this]() { return stop_ || (tasks_.empty() == false); });
+        if(stop_)
+          return;
+
+        const auto* task = tasks_.front();
+        tasks_.pop_front();
+        runTask(task, lock);
+      }
+    }
+
+    // has to be called with the lock taken
+    void runTask(const std::function<void()>* task, std::unique_lock<std::mutex>& lock)
+    {
+      lock.unlock();
+      std::exception_ptr error;
+      try
+      {
+        (*task)();
+      }
+      catch(...)
+      {
+        error = std::current_exception();
+      }
+      lock.lock();
+
+      if((error != nullptr) && (error_ == nullptr))
+        error_ = error;
+      if(--nb_pending_ == 0)
+        done_cv_.notify_all();
+    }
+  };
+
+} // namespace ontologenius
+
+#endif // ONTOLOGENIUS_THREADPOOL_H
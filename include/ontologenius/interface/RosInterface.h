@@ -2,6 +2,9 @@
 #define ONTOLOGENIUS_ROSINTERFACE_H
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -71,6 +74,23 @@ namespace ontologenius {
     /// @brief Allows or not debug display
     /// @param display should be set to false to not allow debug display
     void setDisplay(bool display);
+    /// @brief Makes getName give always the same name among the ones of an entity
+    /// @param deterministic should be set to true to not pick the name randomly
+    void setDeterministicNames(bool deterministic);
+    /// @brief Allows or not the queries to be answered on a read-only copy of the ontology.
+    /// The copy is published by a dedicated thread, only when a query finds it outdated,
+    /// so that queries and feeding do not block each other
+    /// @param snapshot should be set to true to answer the queries on the copy
+    void setSnapshotReads(bool snapshot) { snapshot_reads_ = snapshot; }
+    /// @brief Sets the minimum time between two refreshes of the read-only copy,
+    /// which is thus its maximum age during a continuous feeding.
+    /// Each refresh is a full copy of the ontology, made with the graphs locked for reading
+    /// @param period is the time in milliseconds between two refreshes
+    void setSnapshotPeriod(size_t period) { read_view_period_ = period; }
+    /// @brief Sets the time the feeder waits after the arrival of a fact to apply it with the facts following it.
+    /// The feeder thread sleeps while no fact arrives
+    /// @param latency is the waiting time in milliseconds, 0 applies the facts as soon as they arrive
+    void setFeederLatency(size_t latency) { feeder_latency_ = latency; }
 
 #ifndef ONTO_TEST
   private:
@@ -98,8 +118,8 @@ namespace ontologenius {
     std::string name_;
     /// @brief This varible is set to true when the interface is started and should be set to false to stop it
     std::atomic<bool> run_;
-    /// @brief The rate (in Hz) at which the feeder thread run. Can not be modified while the process is running
-    size_t feeder_rate_;
+    /// @brief The time (in ms) the feeder thread lets a burst of facts gather before applying it
+    std::atomic<size_t> feeder_latency_;
 
     compat::onto_ros::Publisher<std_msgs_compat::String> feeder_end_pub_;
 
@@ -110,6 +130,29 @@ namespace ontologenius {
 
     /// @brief The variable used to display or not debug information. Can be changed at run time
     bool display_;
+    /// @brief Set to true for getName to not pick the name randomly, applied on each new ontology
+    bool deterministic_names_;
+
+    /// @brief Set to true to answer the queries on read_view_ rather than on onto_
+    std::atomic<bool> snapshot_reads_;
+    /// @brief Set to true when onto_ has been modified since read_view_ has been published
+    std::atomic<bool> read_view_outdated_;
+    /// @brief Set to true by a query finding read_view_ outdated, for the read view thread to refresh it
+    bool read_view_requested_;
+    /// @brief The mutex protecting read_view_requested_
+    std::mutex read_view_request_mutex_;
+    /// @brief Wakes up the read view thread on a request
+    std::condition_variable read_view_cv_;
+    /// @brief The mutex taken to copy onto_, and by lock() for onto_ not to be replaced during the copy
+    std::mutex read_view_mutex_;
+    /// @brief Set to true while a burst of facts is being fed, until the post-reasoners have run on it
+    std::atomic<bool> feeding_;
+    /// @brief The last read-only copy of onto_. Must only be accessed through std::atomic_load and std::atomic_store
+    std::shared_ptr<Ontology> read_view_;
+    /// @brief The date of the last publication of read_view_, protected by read_view_mutex_
+    std::chrono::steady_clock::time_point read_view_date_;
+    /// @brief The minimum time (in ms) between two publications of read_view_
+    std::atomic<size_t> read_view_period_;
     /// @brief represents all files provided at the initialization
     std::vector<std::string> files_;
     /// @brief represents the dedicated intern file
@@ -119,6 +162,8 @@ namespace ontologenius {
     void knowledgeCallback(const compat::onto_ros::MessageWrapper<std_msgs_compat::String>& msg);
     /// @brief The ROS topic callback receiving stamped statements
     void stampedKnowledgeCallback(const compat::onto_ros::MessageWrapper<compat::OntologeniusStampedString>& msg);
+    /// @brief The ROS topic callback receiving batches of typed facts
+    void factsCallback(const compat::onto_ros::MessageWrapper<compat::OntologeniusFactArray>& msg);
 
     /// @brief The ROS service callback in charge of general operations on the ontology
     bool actionsHandle(compat::onto_ros::ServiceWrapper<compat::OntologeniusService::Request>& req,
@@ -168,6 +213,19 @@ namespace ontologenius {
     void feedThread();
     /// @brief The thread that run the periodic reasoners
     void periodicReasoning();
+    /// @brief The thread that refreshes the read-only copy when requested, at most once per read_view_period_
+    void readViewThread();
+
+    /// @brief Publishes a new read-only copy of the ontology. The mutex read_view_mutex_ must be locked.
+    /// The copy is a full deep copy of the graphs, proportional to the size of the ontology, during which the writers wait.
+    void publishReadView();
+    /// @brief Asks the read view thread to refresh the read-only copy
+    void requestReadView();
+    /// @brief Gets the ontology on which a query should be answered
+    /// @param updated should be set to true if the pre-reasoners have just modified the ontology
+    /// @return The last published copy if it is up to date or if a feeding is in progress,
+    /// the working ontology otherwise
+    std::shared_ptr<Ontology> getReadView(bool updated = false);
 
     /// @brief Removes usless spaces at the begin and end of a string
     /// @param text is the string on which you want to remove the spaces
@@ -2,8 +2,11 @@
 #define ONTOLOGENIUS_PARAMETERS_H
 
 #include <algorithm>
+#include <cctype>
+#include <cstddef>
 #include <iostream>
 #include <map>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -43,6 +46,20 @@ namespace ontologenius {
         return ((values_.empty() == false) ? values_[0] : "");
     }
 
+    /// @brief Gets the first value as a positive integer. A malformed value is replaced by the default one
+    size_t getFirstUnsigned()
+    {
+      const std::string value = getFirst();
+      size_t res = 0;
+      if(toUnsigned(value, res))
+        return res;
+
+      const std::string default_value = (default_values_.empty() == false) ? default_values_[0] : "0";
+      Display::error("Parameter " + name_ + " expects a positive integer and not '" + value + "', " + default_value + " is used");
+      toUnsigned(default_value, res);
+      return res;
+    }
+
     std::vector<std::string> get() const
     {
       if(values_.empty())
@@ -71,6 +88,23 @@ namespace ontologenius {
           Display::info("\t- " + value);
       }
     }
+
+  private:
+    static bool toUnsigned(const std::string& value, size_t& res)
+    {
+      if(value.empty() || (std::all_of(value.begin(), value.end(), [](char c) { return std::isdigit((unsigned char)c) != 0; }) == false))
+        return false;
+
+      try
+      {
+        res = std::stoul(value);
+        return true;
+      }
+      catch(std::out_of_range&)
+      {
+        return false;
+      }
+    }
   };
 
   class Parameters
@@ -5,6 +5,8 @@ import os
 from std_msgs.msg import String
 from ontologenius.msg import OntologeniusStampedString as StampedString
 from ontologenius.msg import OntologeniusTimestamp as Timestamp
+from ontologenius.msg import OntologeniusFact as Fact
+from ontologenius.msg import OntologeniusFactArray as FactArray
 
 import time
 import random
@@ -34,6 +36,10 @@ class FeederPublisher:
         if self._name != '':
             pub_topic_name += '/' + self._name
         self._stamped_pub = Ontoros.createPublisher(pub_topic_name, StampedString, queue_size=1000)
+        pub_topic_name = 'ontologenius/insert_facts'
+        if self._name != '':
+            pub_topic_name += '/' + self._name
+        self._facts_pub = Ontoros.createPublisher(pub_topic_name, FactArray, queue_size=1000)
         sub_topic_name = 'ontologenius/end'
         if self._name != '':
             sub_topic_name += '/' + self._name
@@ -184,6 +190,33 @@ class FeederPublisher:
             stamp = Ontoros.getRosTime()
         self._publish_stamped(msg, stamp)
 
+    def addRelations(self, relations, probability = 1.0, stamp = None):
+        """Adds in a single message the facts of relations, a list of (concept_from, property, concept_on) tuples of str.
+           A data object is given as 'type#data'. The facts are applied as with addObjectRelation but are not parsed by the feeder.
+           The probability (float) of the added relations is in ]0,1].
+           If the time stamp stamp (rostime) is not defined, the function takes the current ROS time as the time stamp.
+        """
+        if stamp == None:
+            stamp = Ontoros.getRosTime()
+        self._publish_relations(Fact.ADD, relations, probability, stamp)
+
+    def removeRelations(self, relations, stamp = None):
+        """Removes in a single message the facts of relations, a list of (concept_from, property, concept_on) tuples of str.
+           A data object is given as 'type#data'.
+           If the time stamp stamp (rostime) is not defined, the function takes the current ROS time as the time stamp.
+        """
+        if stamp == None:
+            stamp = Ontoros.getRosTime()
+        self._publish_relations(Fact.DEL, relations, 1.0, stamp)
+
+    def publishFacts(self, facts):
+        """Publishes the list of facts (OntologeniusFact) as it is.
+           An empty name of a fact is replaced by the concept of the corresponding index, as given by the index services.
+           The facts are sent on their own topic, they are thus not ordered with the statements sent by the other functions.
+           The facts with an unknown index or a probability out of [0, 1] are rejected and notified as feeder failures.
+        """
+        self._facts_pub.publish(FactArray(facts = facts))
+
     def getNumSubscribers(self):
         """Returns the number of subscribers (int) that are currently connected to the internal ROS publisher."""
         return self._pub.getNumSubscribers()
@@ -286,6 +319,13 @@ class FeederPublisher:
         msg = StampedString(data = data, stamp = stamp_onto)
         self._stamped_pub.publish(msg)
 
+    def _publish_relations(self, action, relations, probability, stamp):
+        stamp_onto = stamp
+        if not isinstance(stamp_onto,Timestamp) : 
+            stamp_onto = Ontoros.getStamp(stamp_onto)
+        facts = [Fact(action = action, subject = s, property = p, object = o, probability = probability, stamp = stamp_onto) for (s, p, o) in relations]
+        self._facts_pub.publish(FactArray(facts = facts))
+
     def commitCallback(self, data):
         if data.data == 'end':
             self._updated = True
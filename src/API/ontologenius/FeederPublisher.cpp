@@ -1,9 +1,11 @@
 #include "ontologenius/API/ontologenius/FeederPublisher.h"
 
+#include <array>
 #include <chrono>
 #include <cstdint>
 #include <string>
 #include <unistd.h>
+#include <vector>
 
 #include "ontologenius/compat/ros.h"
 #include "ontologenius/graphical/Display.h"
@@ -120,6 +122,23 @@ namespace onto {
     publishStamped(msg, stamp);
   }
 
+  void FeederPublisher::addRelations(const std::vector<std::array<std::string, 3>>& relations, double probability, const ontologenius::compat::onto_ros::Time& stamp)
+  {
+    publishRelations(ontologenius::compat::OntologeniusFact::ADD, relations, probability, stamp);
+  }
+
+  void FeederPublisher::removeRelations(const std::vector<std::array<std::string, 3>>& relations, const ontologenius::compat::onto_ros::Time& stamp)
+  {
+    publishRelations(ontologenius::compat::OntologeniusFact::DEL, relations, 1.0, stamp);
+  }
+
+  void FeederPublisher::publishFacts(const std::vector<OntologeniusFact>& facts)
+  {
+    ontologenius::compat::OntologeniusFactArray msg;
+    msg.facts = facts;
+    facts_pub_.publish(msg);
+  }
+
   bool FeederPublisher::waitUpdate(int32_t timeout)
   {
     updated_ = false;
@@ -215,6 +234,24 @@ namespace onto {
     stamped_pub_.publish(msg);
   }
 
+  void FeederPublisher::publishRelations(uint8_t action, const std::vector<std::array<std::string, 3>>& relations, double probability, const ontologenius::compat::onto_ros::Time& stamp)
+  {
+    ontologenius::compat::OntologeniusFactArray msg;
+    msg.facts.resize(relations.size());
+    for(size_t i = 0; i < relations.size(); i++)
+    {
+      auto& fact = msg.facts[i];
+      fact.action = action;
+      fact.subject = relations[i][0];
+      fact.property = relations[i][1];
+      fact.object = relations[i][2];
+      fact.probability = probability;
+      fact.stamp.seconds = stamp.seconds();
+      fact.stamp.nanoseconds = stamp.nanoseconds();
+    }
+    facts_pub_.publish(msg);
+  }
+
   void FeederPublisher::commitCallback(const ontologenius::compat::onto_ros::MessageWrapper<std_msgs_compat::String>& msg)
   {
     if(msg->data == "end")
@@ -2,74 +2,24 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <iostream>
+#include <mutex>
 #include <queue>
-#include <regex>
 #include <string>
 #include <utility>
 #include <vector>
 
 namespace ontologenius {
 
-  FeedStorage::FeedStorage() : base_regex_(R"(^\[(\w+)\](.*)\|(.*)\|(.*)$)"),
-                               simple_regex_(R"(^\[(\w+)\](.*)\|$)"),
-                               queue_choice_(true)
+  FeedStorage::FeedStorage() : queue_choice_(true)
   {}
 
   void FeedStorage::add(const std::string& regex, const RosTime_t& stamp)
   {
-    std::smatch base_match;
     Feed_t feed;
     feed.stamp = stamp;
-    if(std::regex_match(regex, base_match, base_regex_))
-    {
-      if(base_match.size() == 5)
-      {
-        std::string action = base_match[1].str();
-        std::transform(action.begin(), action.end(), action.begin(), ::tolower);
-        if(action == "add")
-          feed.action_ = action_add;
-        else if(action == "del")
-          feed.action_ = action_del;
-        else if(action == "nop")
-          feed.action_ = action_nop;
-        else
-        {
-          std::cout << "data do not match" << std::endl;
-          return;
-        }
-        feed.from_ = base_match[2].str();
-        feed.prop_ = base_match[3].str();
-        feed.on_ = base_match[4].str();
-      }
-    }
-    else if(std::regex_match(regex, base_match, simple_regex_))
-    {
-      if(base_match.size() == 3)
-      {
-        std::string action = base_match[1].str();
-        std::transform(action.begin(), action.end(), action.begin(), ::tolower);
-        if(action == "add")
-          feed.action_ = action_add;
-        else if(action == "del")
-          feed.action_ = action_del;
-        else if(action == "commit")
-          feed.action_ = action_commit;
-        else if(action == "checkout")
-          feed.action_ = action_checkout;
-        else if(action == "nop")
-          feed.action_ = action_nop;
-        else
-        {
-          std::cout << "data do not match" << std::endl;
-          return;
-        }
-        feed.from_ = base_match[2].str();
-      }
-    }
-    else if(regex == "[nop]")
-      feed.action_ = action_nop;
-    else
+    if(parse(regex, feed) == false)
     {
       std::cout << "data do not match" << std::endl;
       return;
@@ -81,6 +31,80 @@ namespace ontologenius {
     else
       fifo_2_.push(feed);
     mutex_.unlock();
+
+    cv_.notify_one();
+  }
+
+  // Accepts the same inputs as the regexes ^\[(\w+)\](.*)\|(.*)\|(.*)$
+  // and then ^\[(\w+)\](.*)\|$ with the greedy groups of std::regex
+  bool FeedStorage::parse(const std::string& str, Feed_t& feed)
+  {
+    if(str == "[nop]")
+    {
+      feed.action_ = action_nop;
+      return true;
+    }
+
+    if(str.empty() || (str[0] != '['))
+      return false;
+
+    size_t action_end = 1;
+    while((action_end < str.size()) && isWordChar(str[action_end]))
+      action_end++;
+    if((action_end == 1) || (action_end == str.size()) || (str[action_end] != ']'))
+      return false;
+
+    // the two last separators, as the first group is greedy
+    size_t last = std::string::npos;
+    size_t before_last = std::string::npos;
+    for(size_t i = action_end + 1; i < str.size(); i++)
+    {
+      if((str[i] == '\n') || (str[i] == '\r')) // not matched by .
+        return false;
+      else if(str[i] == '|')
+      {
+        before_last = last;
+        last = i;
+      }
+    }
+
+    std::string action = str.substr(1, action_end - 1);
+    std::transform(action.begin(), action.end(), action.begin(), ::tolower);
+
+    if(before_last != std::string::npos)
+    {
+      if(action == "add")
+        feed.action_ = action_add;
+      else if(action == "del")
+        feed.action_ = action_del;
+      else if(action == "nop")
+        feed.action_ = action_nop;
+      else
+        return false;
+      feed.from_ = str.substr(action_end + 1, before_last - action_end - 1);
+      feed.prop_ = str.substr(before_last + 1, last - before_last - 1);
+      feed.on_ = str.substr(last + 1);
+    }
+    else if((last != std::string::npos) && (last == str.size() - 1))
+    {
+      if(action == "add")
+        feed.action_ = action_add;
+      else if(action == "del")
+        feed.action_ = action_del;
+      else if(action == "commit")
+        feed.action_ = action_commit;
+      else if(action == "checkout")
+        feed.action_ = action_checkout;
+      else if(action == "nop")
+        feed.action_ = action_nop;
+      else
+        return false;
+      feed.from_ = str.substr(action_end + 1, last - action_end - 1);
+    }
+    else
+      return false;
+
+    return true;
   }
 
   void FeedStorage::add(std::vector<Feed_t>& datas)
@@ -97,6 +121,18 @@ namespace ontologenius {
         fifo_2_.push(data);
     }
     mutex_.unlock();
+
+    if(datas.empty() == false)
+      cv_.notify_one();
+  }
+
+  bool FeedStorage::wait(std::chrono::milliseconds timeout)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto& fifo = (queue_choice_ == true) ? fifo_1_ : fifo_2_;
+    if(fifo.empty())
+      cv_.wait_for(lock, timeout);
+    return (((queue_choice_ == true) ? fifo_1_ : fifo_2_).empty() == false);
   }
 
   std::queue<Feed_t> FeedStorage::get()
@@ -1,10 +1,13 @@
 #include "ontologenius/core/feeder/Feeder.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <mutex>
 #include <queue>
 #include <shared_mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "ontologenius/core/feeder/FeedStorage.h"
 #include "ontologenius/core/ontoGraphs/Branchs/ClassBranch.h"
@@ -13,8 +16,7 @@
 
 namespace ontologenius {
 
-  Feeder::Feeder(Ontology* onto, bool versioning) : versionor_(&feed_storage_),
-                                                    onto_(onto),
+  Feeder::Feeder(Ontology* onto, bool versioning) : onto_(onto),
                                                     do_versioning_(versioning)
   {}
 
@@ -23,68 +25,198 @@ namespace ontologenius {
     if(onto_ == nullptr)
       return false;
 
-    bool has_run = false;
-    std::queue<Feed_t> feeds = feed_storage_.get();
+    std::queue<Feed_t> queue = feed_storage_.get();
+    if(queue.empty())
+      return false;
 
-    while(feeds.empty() == false)
+    std::vector<Feed_t> feeds;
+    feeds.reserve(queue.size());
+    while(queue.empty() == false)
     {
-      has_run = true;
-      Feed_t feed = feeds.front();
-      feeds.pop();
+      feeds.push_back(std::move(queue.front()));
+      queue.pop();
+    }
 
-      if(feed.action_ == action_add)
-        current_str_feed_ = "[add]" + feed.from_ + "|" + feed.prop_ + "|" + feed.on_;
-      else if(feed.action_ == action_del)
-        current_str_feed_ = "[del]" + feed.from_ + "|" + feed.prop_ + "|" + feed.on_;
+    resolveIndexes(feeds);
+    rejectInvalidFeeds(feeds);
+    applyFeeds(feeds);
+
+    return true;
+  }
+
+  void Feeder::applyFeeds(std::vector<Feed_t>& feeds)
+  {
+    // The whole batch is applied under a single acquisition of the graph locks,
+    // in the same order as the queries: individuals, classes, then properties.
+    // The feeds keep their order as each one can depend on the previous ones.
+    const std::lock_guard<std::shared_timed_mutex> lock_indiv(onto_->individual_graph_.mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock_class(onto_->class_graph_.mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock_object(onto_->object_property_graph_.mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock_data(onto_->data_property_graph_.mutex_);
+
+    for(auto& feed : feeds)
+      applyFeed(feed, getType(feed));
+
+    // the relations are moved now if the property taxonomy changed, rather than on the next modification
+    onto_->individual_graph_.updateRelationIndexesUnsafe();
+    onto_->class_graph_.updateRelationIndexesUnsafe();
+  }
+
+  void Feeder::resolveIndexes(std::vector<Feed_t>& feeds)
+  {
+    // The names are still needed for the versioning, the notifications and the
+    // properties and objects of the relations. The index of the subject is kept
+    // for its branch to be found without looking up its name.
+    // The identifiers are shared by all the graphs, except for the literals.
+    std::vector<index_t> indexes;
+    std::vector<std::string*> names;
+    std::vector<index_t> literal_indexes;
+    std::vector<std::string*> literal_names;
+    for(auto& feed : feeds)
+    {
+      if(feed.from_.empty() && (feed.from_index_ > 0))
+      {
+        indexes.push_back(feed.from_index_);
+        names.push_back(&feed.from_);
+      }
       else
+        feed.from_index_ = 0; // a given name prevails over the index
+      if(feed.prop_.empty() && (feed.prop_index_ > 0))
       {
-        if(feed.action_ == action_commit)
-        {
-          if(!versionor_.commit(feed.from_))
-            notifications_.push_back("[FAIL][commit]" + feed.from_);
-        }
-        else if(feed.action_ == action_checkout)
-        {
-          if(!versionor_.checkout(feed.from_))
-            notifications_.push_back("[FAIL][checkout]" + feed.from_);
-        }
-        continue;
+        indexes.push_back(feed.prop_index_);
+        names.push_back(&feed.prop_);
+      }
+      if(feed.on_.empty() && (feed.on_index_ > 0))
+      {
+        indexes.push_back(feed.on_index_);
+        names.push_back(&feed.on_);
+      }
+      else if(feed.on_.empty() && (feed.on_index_ < 0))
+      {
+        literal_indexes.push_back(feed.on_index_);
+        literal_names.push_back(&feed.on_);
       }
+    }
 
-      if(do_versioning_ && !feed.checkout_)
-        versionor_.insert(feed);
+    if(indexes.empty() == false)
+    {
+      auto identifiers = onto_->class_graph_.getIdentifiers(indexes);
+      for(size_t i = 0; i < identifiers.size(); i++)
+        *names[i] = std::move(identifiers[i]);
+    }
 
-      if(addFeed(feed))
-        valid_relations_.emplace_back(current_str_feed_, feed.stamp);
+    if(literal_indexes.empty() == false)
+    {
+      auto identifiers = onto_->data_property_graph_.getLiteralIdentifiers(literal_indexes);
+      for(size_t i = 0; i < identifiers.size(); i++)
+        *literal_names[i] = std::move(identifiers[i]);
     }
+  }
+
+  void Feeder::rejectInvalidFeeds(std::vector<Feed_t>& feeds)
+  {
+    // Only the facts given as messages can carry indexes or a probability
+    auto invalid = std::remove_if(feeds.begin(), feeds.end(), [this](const Feed_t& feed) {
+      const bool unknown_index = (feed.from_.empty() && (feed.from_index_ != 0)) ||
+                                 (feed.prop_.empty() && (feed.prop_index_ != 0)) ||
+                                 (feed.on_.empty() && (feed.on_index_ != 0));
+      const bool invalid_probability = !((feed.probability_ >= 0) && (feed.probability_ <= 1)); // also rejects NaN
+      if((unknown_index == false) && (invalid_probability == false))
+        return false;
 
-    return has_run;
+      const std::string str_feed = ((feed.action_ == action_add) ? "[add]" : "[del]") +
+                                   (feed.from_.empty() ? std::to_string(feed.from_index_) : feed.from_) + "|" +
+                                   (feed.prop_.empty() ? std::to_string(feed.prop_index_) : feed.prop_) + "|" +
+                                   (feed.on_.empty() ? std::to_string(feed.on_index_) : feed.on_);
+      if(unknown_index)
+        notifications_.push_back("[FAIL][unknown index]" + str_feed);
+      else
+        notifications_.push_back("[FAIL][probability " + std::to_string(feed.probability_) + " out of [0, 1]]" + str_feed);
+      return true;
+    });
+    feeds.erase(invalid, feeds.end());
   }
 
-  bool Feeder::addFeed(Feed_t& feed)
+  FeedType_e Feeder::getType(const Feed_t& feed)
   {
     if(feed.prop_.empty())
+      return feed_concept;
+    else if(feed.on_.empty())
+      return feed_invalid;
+    else if((feed.prop_ == "+") || (feed.prop_ == "rdfs:subClassOf") || (feed.prop_ == "isA"))
+      return feed_inheritance;
+    else if((feed.prop_ == "<-") || (feed.prop_ == "owl:inverseOf"))
+      return feed_inverse_of;
+    else if(feed.prop_[0] == '@')
+      return feed_language;
+    else if((feed.prop_ == "=") || (feed.prop_ == "owl:sameAs") || (feed.prop_ == "sameAs"))
+      return feed_same_as;
+    else
+      return feed_relation;
+  }
+
+  void Feeder::setCurrentFeed(const Feed_t& feed)
+  {
+    if(feed.action_ == action_add)
+      current_str_feed_ = "[add]" + feed.from_ + "|" + feed.prop_ + "|" + feed.on_;
+    else
+      current_str_feed_ = "[del]" + feed.from_ + "|" + feed.prop_ + "|" + feed.on_;
+  }
+
+  bool Feeder::applyFeed(Feed_t& feed, FeedType_e type)
+  {
+    if(feed.action_ == action_commit)
     {
-      if(onto_->class_graph_.findBranchSafe(feed.from_) != nullptr)
-        return addDelClass(feed.action_, feed.from_);
-      else
-        return addDelIndiv(feed.action_, feed.from_);
+      if(!versionor_.commit(feed.from_))
+        notifications_.push_back("[FAIL][commit]" + feed.from_);
+      return false;
     }
-    else if(feed.on_.empty() == false)
+    else if(feed.action_ == action_checkout)
     {
-      if((feed.prop_ == "+") || (feed.prop_ == "rdfs:subClassOf") || (feed.prop_ == "isA"))
-        return addInheritage(feed);
-      else if((feed.prop_ == "<-") || (feed.prop_ == "owl:inverseOf"))
-        return addInverseOf(feed);
-      else if(feed.prop_[0] == '@')
-        return modifyLangage(feed);
-      else if((feed.prop_ == "=") || (feed.prop_ == "owl:sameAs") || (feed.prop_ == "sameAs"))
-        return addSameAs(feed);
+      // The feeds of the checkout are applied right away, within the locks of the batch
+      // so that no reader can see a half applied version
+      std::vector<Feed_t> datas;
+      if(!versionor_.checkout(feed.from_, datas))
+        notifications_.push_back("[FAIL][checkout]" + feed.from_);
       else
-        return applyProperty(feed);
+      {
+        for(auto& data : datas)
+          applyFeed(data, getType(data));
+      }
+      return false;
+    }
+    else if((feed.action_ != action_add) && (feed.action_ != action_del))
+      return false;
+
+    setCurrentFeed(feed);
+
+    if(do_versioning_ && !feed.checkout_)
+      versionor_.insert(feed);
+
+    if(addFeed(feed, type))
+    {
+      valid_relations_.emplace_back(current_str_feed_, feed.stamp);
+      return true;
     }
     else
+      return false;
+  }
+
+  bool Feeder::addFeed(Feed_t& feed, FeedType_e type)
+  {
+    switch(type)
     {
+    case feed_concept:
+      if(((feed.from_index_ > 0) ? onto_->class_graph_.findBranch(feed.from_index_) : onto_->class_graph_.findBranch(feed.from_)) != nullptr)
+        return addDelClass(feed.action_, feed.from_);
+      else
+        return addDelIndiv(feed.action_, feed.from_);
+    case feed_inheritance: return addInheritage(feed);
+    case feed_inverse_of: return addInverseOf(feed);
+    case feed_language: return modifyLangage(feed);
+    case feed_same_as: return addSameAs(feed);
+    case feed_relation: return applyProperty(feed);
+    default:
       notifications_.push_back("[FAIL][not enough arguments]" + current_str_feed_);
       return false;
     }
@@ -94,14 +226,13 @@ namespace ontologenius {
   {
     if(action == action_add)
     {
-      const std::lock_guard<std::shared_timed_mutex> lock(onto_->class_graph_.mutex_);
       onto_->class_graph_.findOrCreateBranch(name);
       return true;
     }
     else
     {
-      ClassBranch* tmp = onto_->class_graph_.findBranchSafe(name);
-      onto_->class_graph_.deleteClass(tmp);
+      ClassBranch* tmp = onto_->class_graph_.findBranch(name);
+      onto_->class_graph_.deleteClassUnsafe(tmp);
       return (tmp != nullptr);
     }
   }
@@ -110,13 +241,13 @@ namespace ontologenius {
   {
     if(action == action_add)
     {
-      onto_->individual_graph_.findOrCreateBranchSafe(name);
+      onto_->individual_graph_.findOrCreateBranch(name);
       return true;
     }
     else
     {
-      IndividualBranch* tmp = onto_->individual_graph_.findBranchSafe(name);
-      onto_->individual_graph_.deleteIndividual(tmp);
+      IndividualBranch* tmp = onto_->individual_graph_.findBranch(name);
+      onto_->individual_graph_.deleteIndividualUnsafe(tmp);
       return (tmp != nullptr);
     }
   }
@@ -127,20 +258,20 @@ namespace ontologenius {
     {
       if(feed.action_ == action_add)
       {
-        if(onto_->class_graph_.findBranchSafe(feed.from_) != nullptr)
-          return onto_->class_graph_.addInheritage(feed.from_, feed.on_);
-        else if(onto_->individual_graph_.findBranchSafe(feed.from_) != nullptr)
-          return onto_->individual_graph_.addInheritage(feed.from_, feed.on_);
-        else if(onto_->class_graph_.findBranchSafe(feed.on_) != nullptr)
-          return onto_->individual_graph_.addInheritageInvert(feed.from_, feed.on_);
-        else if(onto_->individual_graph_.findBranchSafe(feed.on_) != nullptr)
-          return onto_->individual_graph_.addInheritageInvertUpgrade(feed.from_, feed.on_);
-        else if((onto_->data_property_graph_.findBranchSafe(feed.from_) != nullptr) ||
-                (onto_->data_property_graph_.findBranchSafe(feed.on_) != nullptr))
-          return onto_->data_property_graph_.addInheritage(feed.from_, feed.on_);
-        else if((onto_->object_property_graph_.findBranchSafe(feed.from_) != nullptr) ||
-                (onto_->object_property_graph_.findBranchSafe(feed.on_) != nullptr))
-          return onto_->object_property_graph_.addInheritage(feed.from_, feed.on_);
+        if(onto_->class_graph_.findBranch(feed.from_) != nullptr)
+          return onto_->class_graph_.addInheritageUnsafe(feed.from_, feed.on_);
+        else if(onto_->individual_graph_.findBranch(feed.from_) != nullptr)
+          return onto_->individual_graph_.addInheritageUnsafe(feed.from_, feed.on_);
+        else if(onto_->class_graph_.findBranch(feed.on_) != nullptr)
+          return onto_->individual_graph_.addInheritageInvertUnsafe(feed.from_, feed.on_);
+        else if(onto_->individual_graph_.findBranch(feed.on_) != nullptr)
+          return onto_->individual_graph_.addInheritageInvertUpgradeUnsafe(feed.from_, feed.on_);
+        else if((onto_->data_property_graph_.findBranch(feed.from_) != nullptr) ||
+                (onto_->data_property_graph_.findBranch(feed.on_) != nullptr))
+          return onto_->data_property_graph_.addInheritageUnsafe(feed.from_, feed.on_);
+        else if((onto_->object_property_graph_.findBranch(feed.from_) != nullptr) ||
+                (onto_->object_property_graph_.findBranch(feed.on_) != nullptr))
+          return onto_->object_property_graph_.addInheritageUnsafe(feed.from_, feed.on_);
         else
         {
           notifications_.push_back("[FAIL][no known items in the requested inheritance]" + current_str_feed_);
@@ -149,24 +280,24 @@ namespace ontologenius {
       }
       else if(feed.action_ == action_del)
       {
-        if(onto_->class_graph_.findBranchSafe(feed.from_) != nullptr)
+        if(onto_->class_graph_.findBranch(feed.from_) != nullptr)
         {
-          auto tmp = onto_->class_graph_.removeInheritage(feed.from_, feed.on_);
+          auto tmp = onto_->class_graph_.removeInheritageUnsafe(feed.from_, feed.on_);
           explanations_.insert(explanations_.end(), tmp.begin(), tmp.end());
         }
-        else if(onto_->individual_graph_.findBranchSafe(feed.from_) != nullptr)
+        else if(onto_->individual_graph_.findBranch(feed.from_) != nullptr)
         {
-          auto tmp = onto_->individual_graph_.removeInheritage(feed.from_, feed.on_);
+          auto tmp = onto_->individual_graph_.removeInheritageUnsafe(feed.from_, feed.on_);
           explanations_.insert(explanations_.end(), tmp.begin(), tmp.end());
         }
-        else if(onto_->object_property_graph_.findBranchSafe(feed.from_) != nullptr)
+        else if(onto_->object_property_graph_.findBranch(feed.from_) != nullptr)
         {
-          auto tmp = onto_->object_property_graph_.removeInheritage(feed.from_, feed.on_);
+          auto tmp = onto_->object_property_graph_.removeInheritageUnsafe(feed.from_, feed.on_);
           explanations_.insert(explanations_.end(), tmp.begin(), tmp.end());
         }
-        else if(onto_->data_property_graph_.findBranchSafe(feed.from_) != nullptr)
+        else if(onto_->data_property_graph_.findBranch(feed.from_) != nullptr)
         {
-          auto tmp = onto_->data_property_graph_.removeInheritage(feed.from_, feed.on_);
+          auto tmp = onto_->data_property_graph_.removeInheritageUnsafe(feed.from_, feed.on_);
           explanations_.insert(explanations_.end(), tmp.begin(), tmp.end());
         }
         else
@@ -188,7 +319,7 @@ namespace ontologenius {
   {
     if(feed.action_ == action_add)
     {
-      if(!onto_->object_property_graph_.addInverseOf(feed.from_, feed.on_))
+      if(!onto_->object_property_graph_.addInverseOfUnsafe(feed.from_, feed.on_))
       {
         notifications_.push_back("[FAIL][no known items in the request]" + current_str_feed_);
         return false;
@@ -198,7 +329,7 @@ namespace ontologenius {
     }
     else if(feed.action_ == action_del)
     {
-      if(!onto_->object_property_graph_.removeInverseOf(feed.from_, feed.on_))
+      if(!onto_->object_property_graph_.removeInverseOfUnsafe(feed.from_, feed.on_))
       {
         notifications_.push_back("[FAIL][unknown item in the request]" + current_str_feed_);
         return false;
@@ -216,12 +347,12 @@ namespace ontologenius {
     {
       if(feed.action_ == action_add)
       {
-        onto_->individual_graph_.addSameAs(feed.from_, feed.on_);
+        onto_->individual_graph_.addSameAsUnsafe(feed.from_, feed.on_);
         return true;
       }
       else if(feed.action_ == action_del)
       {
-        auto tmp = onto_->individual_graph_.removeSameAs(feed.from_, feed.on_);
+        auto tmp = onto_->individual_graph_.removeSameAsUnsafe(feed.from_, feed.on_);
         if(tmp.empty() == false)
           explanations_.insert(explanations_.end(), tmp.begin(), tmp.end());
         return true;
@@ -240,14 +371,14 @@ namespace ontologenius {
   {
     if(feed.action_ == action_add)
     {
-      if(onto_->class_graph_.findBranchSafe(feed.from_) != nullptr)
-        return onto_->class_graph_.addLang(feed.from_, feed.prop_, feed.on_);
-      else if(onto_->individual_graph_.findBranchSafe(feed.from_) != nullptr)
-        return onto_->individual_graph_.addLang(feed.from_, feed.prop_, feed.on_);
-      else if(onto_->object_property_graph_.findBranchSafe(feed.from_) != nullptr)
-        return onto_->object_property_graph_.addLang(feed.from_, feed.prop_, feed.on_);
-      else if(onto_->data_property_graph_.findBranchSafe(feed.from_) != nullptr)
-        return onto_->data_property_graph_.addLang(feed.from_, feed.prop_, feed.on_);
+      if(onto_->class_graph_.findBranch(feed.from_) != nullptr)
+        return onto_->class_graph_.addLangUnsafe(feed.from_, feed.prop_, feed.on_);
+      else if(onto_->individual_graph_.findBranch(feed.from_) != nullptr)
+        return onto_->individual_graph_.addLangUnsafe(feed.from_, feed.prop_, feed.on_);
+      else if(onto_->object_property_graph_.findBranch(feed.from_) != nullptr)
+        return onto_->object_property_graph_.addLangUnsafe(feed.from_, feed.prop_, feed.on_);
+      else if(onto_->data_property_graph_.findBranch(feed.from_) != nullptr)
+        return onto_->data_property_graph_.addLangUnsafe(feed.from_, feed.prop_, feed.on_);
       else
       {
         notifications_.push_back("[FAIL][unknown element in the requested language addition]" + current_str_feed_);
@@ -256,14 +387,14 @@ namespace ontologenius {
     }
     else if(feed.action_ == action_del)
     {
-      if(onto_->class_graph_.findBranchSafe(feed.from_) != nullptr)
-        return onto_->class_graph_.removeLang(feed.from_, feed.prop_, feed.on_);
-      else if(onto_->individual_graph_.findBranchSafe(feed.from_) != nullptr)
-        return onto_->individual_graph_.removeLang(feed.from_, feed.prop_, feed.on_);
-      else if(onto_->object_property_graph_.findBranchSafe(feed.from_) != nullptr)
-        return onto_->object_property_graph_.removeLang(feed.from_, feed.prop_, feed.on_);
-      else if(onto_->data_property_graph_.findBranchSafe(feed.from_) != nullptr)
-        return onto_->data_property_graph_.removeLang(feed.from_, feed.prop_, feed.on_);
+      if(onto_->class_graph_.findBranch(feed.from_) != nullptr)
+        return onto_->class_graph_.removeLangUnsafe(feed.from_, feed.prop_, feed.on_);
+      else if(onto_->individual_graph_.findBranch(feed.from_) != nullptr)
+        return onto_->individual_graph_.removeLangUnsafe(feed.from_, feed.prop_, feed.on_);
+      else if(onto_->object_property_graph_.findBranch(feed.from_) != nullptr)
+        return onto_->object_property_graph_.removeLangUnsafe(feed.from_, feed.prop_, feed.on_);
+      else if(onto_->data_property_graph_.findBranch(feed.from_) != nullptr)
+        return onto_->data_property_graph_.removeLangUnsafe(feed.from_, feed.prop_, feed.on_);
       else
       {
         notifications_.push_back("[FAIL][unknown element in the requested language deletion]" + current_str_feed_);
@@ -295,34 +426,36 @@ namespace ontologenius {
     {
       if(feed.action_ == action_add)
       {
-        indiv_branch = onto_->individual_graph_.findBranchSafe(feed.from_);
+        indiv_branch = (feed.from_index_ > 0) ? onto_->individual_graph_.findBranch(feed.from_index_)
+                                              : onto_->individual_graph_.findBranch(feed.from_);
         if(indiv_branch != nullptr)
         {
           if(data_property == true)
-            onto_->individual_graph_.addRelation(indiv_branch, feed.prop_, type, data);
+            onto_->individual_graph_.addRelationUnsafe(indiv_branch, feed.prop_, type, data, feed.probability_);
           else
-            onto_->individual_graph_.addRelation(indiv_branch, feed.prop_, feed.on_);
+            onto_->individual_graph_.addRelationUnsafe(indiv_branch, feed.prop_, feed.on_, feed.probability_);
         }
         else
         {
-          class_branch = onto_->class_graph_.findBranchSafe(feed.from_);
+          class_branch = (feed.from_index_ > 0) ? onto_->class_graph_.findBranch(feed.from_index_)
+                                                : onto_->class_graph_.findBranch(feed.from_);
           if(class_branch != nullptr)
           {
             if(data_property == true)
-              onto_->class_graph_.addRelation(class_branch, feed.prop_, type, data);
+              onto_->class_graph_.addRelationUnsafe(class_branch, feed.prop_, type, data, feed.probability_);
             else
-              onto_->class_graph_.addRelation(class_branch, feed.prop_, feed.on_);
+              onto_->class_graph_.addRelationUnsafe(class_branch, feed.prop_, feed.on_, feed.probability_);
           }
           else
           {
-            class_branch = onto_->class_graph_.findBranchSafe(feed.on_);
+            class_branch = onto_->class_graph_.findBranch(feed.on_);
             if(class_branch != nullptr)
-              onto_->class_graph_.addRelationInvert(feed.from_, feed.prop_, class_branch);
+              onto_->class_graph_.addRelationInvertUnsafe(feed.from_, feed.prop_, class_branch, feed.probability_);
             else
             {
-              indiv_branch = onto_->individual_graph_.findBranchSafe(feed.on_);
+              indiv_branch = onto_->individual_graph_.findBranch(feed.on_);
               if(indiv_branch != nullptr)
-                onto_->individual_graph_.addRelationInvert(feed.from_, feed.prop_, indiv_branch);
+                onto_->individual_graph_.addRelationInvertUnsafe(feed.from_, feed.prop_, indiv_branch, feed.probability_);
               else
               {
                 notifications_.push_back("[FAIL][unknown concept to apply property]" + current_str_feed_);
@@ -334,23 +467,23 @@ namespace ontologenius {
       }
       else if(feed.action_ == action_del)
       {
-        if(onto_->class_graph_.findBranchSafe(feed.from_) != nullptr)
+        if(onto_->class_graph_.findBranch(feed.from_) != nullptr)
         {
           if(data_property == true)
-            onto_->class_graph_.removeRelation(feed.from_, feed.prop_, type, data);
+            onto_->class_graph_.removeRelationUnsafe(feed.from_, feed.prop_, type, data);
           else
-            onto_->class_graph_.removeRelation(feed.from_, feed.prop_, feed.on_);
+            onto_->class_graph_.removeRelationUnsafe(feed.from_, feed.prop_, feed.on_);
         }
-        else if(onto_->individual_graph_.findBranchSafe(feed.from_) != nullptr)
+        else if(onto_->individual_graph_.findBranch(feed.from_) != nullptr)
         {
           if(data_property == true)
           {
-            auto tmp = onto_->individual_graph_.removeRelation(feed.from_, feed.prop_, type, data);
+            auto tmp = onto_->individual_graph_.removeRelationUnsafe(feed.from_, feed.prop_, type, data);
             explanations_.insert(explanations_.end(), tmp.begin(), tmp.end());
           }
           else
           {
-            auto tmp = onto_->individual_graph_.removeRelation(feed.from_, feed.prop_, feed.on_);
+            auto tmp = onto_->individual_graph_.removeRelationUnsafe(feed.from_, feed.prop_, feed.on_);
             explanations_.insert(explanations_.end(), tmp.begin(), tmp.end());
           }
         }
@@ -3,14 +3,31 @@
 #include <algorithm>
 #include <cstddef>
 #include <iostream>
+#include <memory>
 #include <numeric>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ontologenius/core/feeder/FeedStorage.h"
 
 namespace ontologenius {
 
+  void VersionState_t::apply(const VersionDelta_t& delta)
+  {
+    auto it = facts_.find(delta.fact_);
+    if(it == facts_.end())
+      facts_.emplace(delta.fact_, VersionFactState_t{delta.action_, delta.action_, delta.probability_, delta.stamp_, nb_deltas_});
+    else
+    {
+      it->second.last_action_ = delta.action_;
+      it->second.probability_ = delta.probability_;
+      it->second.stamp_ = delta.stamp_;
+      it->second.position_ = nb_deltas_;
+    }
+    nb_deltas_++;
+  }
+
   VersionNode::VersionNode(size_t order, VersionNode* prev) : order_id_(order),
                                                               prev_(prev)
   {
@@ -23,31 +40,15 @@ namespace ontologenius {
                                                                   prev_(nullptr)
   {}
 
-  std::vector<Feed_t> VersionNode::getDatasDirect()
-  {
-    return datas_;
-  }
-
-  std::vector<Feed_t> VersionNode::getDatasInvert()
-  {
-    std::vector<Feed_t> datas = datas_;
-    std::reverse(datas.begin(), datas.end());
-    for(auto& data : datas)
-      data.action_ = (data.action_ == action_add) ? action_del : action_add;
-    return datas;
-  }
-
-  void VersionNode::appendDatasDirect(std::vector<Feed_t>& datas)
+  void VersionNode::applyDeltas(VersionState_t& state) const
   {
-    datas.insert(datas.end(), datas_.begin(), datas_.end());
+    for(const auto& delta : deltas_)
+      state.apply(delta);
   }
 
-  void VersionNode::appendDatasInvert(std::vector<Feed_t>& datas)
+  void VersionNode::setSnapshot(std::unique_ptr<VersionState_t> snapshot)
   {
-    std::vector<Feed_t> tmp_datas = datas_;
-    for(auto& data : tmp_datas)
-      data.action_ = (data.action_ == action_add) ? action_del : action_add;
-    datas.insert(datas.end(), tmp_datas.rbegin(), tmp_datas.rend());
+    snapshot_ = std::move(snapshot);
   }
 
   void VersionNode::unlinkFromPrev()
@@ -59,23 +60,23 @@ namespace ontologenius {
     }
   }
 
-  void VersionNode::print(int level)
+  void VersionNode::print(const VersionWords& words, int level)
   {
-    for(auto& data : datas_)
-      std::cout << getSpaces(level) << std::string((data.action_ == action_add) ? "+" : "-") << data.from_ << ":" << data.prop_ << ":" << data.on_ << std::endl;
+    for(auto& delta : deltas_)
+      std::cout << getSpaces(level) << std::string((delta.action_ == action_add) ? "+" : "-") << words.get(delta.fact_.from_) << ":" << words.get(delta.fact_.prop_) << ":" << words.get(delta.fact_.on_) << std::endl;
     std::cout << getSpaces(level) << "--" << id_ << "--" << std::endl;
     level++;
     for(auto& next : nexts_)
-      next->print(level);
+      next->print(words, level);
   }
 
-  std::string VersionNode::toXml(int level)
+  std::string VersionNode::toXml(const VersionWords& words, int level)
   {
     std::string xml;
     xml += getSpaces(level) + "<Node id=\"" + id_ + "\">\n";
     xml += getSpaces(level + 1) + orderIdToXml() + "\n";
-    xml = std::accumulate(datas_.begin(), datas_.end(), xml, [level, this](auto base, const Feed_t& data) { return base + this->getSpaces(level + 1) + this->dataToXml(data) + "\n"; });
-    xml = std::accumulate(nexts_.begin(), nexts_.end(), xml, [level](auto base, auto next) { return base + next->toXml(level + 1); });
+    xml = std::accumulate(deltas_.begin(), deltas_.end(), xml, [level, &words, this](auto base, const VersionDelta_t& delta) { return base + this->getSpaces(level + 1) + this->dataToXml(delta, words) + "\n"; });
+    xml = std::accumulate(nexts_.begin(), nexts_.end(), xml, [level, &words](auto base, auto next) { return base + next->toXml(words, level + 1); });
     xml += getSpaces(level) + "</Node>\n";
     return xml;
   }
@@ -88,10 +89,10 @@ namespace ontologenius {
     return res;
   }
 
-  std::string VersionNode::dataToXml(const Feed_t& data) const
+  std::string VersionNode::dataToXml(const VersionDelta_t& delta, const VersionWords& words) const
   {
-    std::string xml = "<Data action=\"" + std::string((data.action_ == action_add) ? "add" : "del") +
-                      "\">" + data.from_ + "|" + data.prop_ + "|" + data.on_ +
+    std::string xml = "<Data action=\"" + std::string((delta.action_ == action_add) ? "add" : "del") +
+                      "\">" + words.get(delta.fact_.from_) + "|" + words.get(delta.fact_.prop_) + "|" + words.get(delta.fact_.on_) +
                       "</Data>";
     return xml;
   }
@@ -1,22 +1,31 @@
 #include "ontologenius/core/feeder/Versionor.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdio>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ontologenius/core/feeder/FeedStorage.h"
 #include "ontologenius/core/feeder/VersionNode.h"
 #include "ontologenius/graphical/Display.h"
 
+#define VERSION_SNAPSHOT_MAX_DEPTH 16
+#define VERSION_SNAPSHOT_MAX_DELTAS 4096
+#define VERSION_SNAPSHOTS_MAX_SIZE 1000000 // facts kept in all the snapshots
+
 namespace ontologenius {
 
-  Versionor::Versionor(FeedStorage* storage) : activated_(false),
-                                               storage_(storage),
-                                               order_(0)
+  Versionor::Versionor() : activated_(false),
+                           order_(0),
+                           snapshots_size_(0),
+                           snapshots_max_size_(VERSION_SNAPSHOTS_MAX_SIZE)
   {
     auto* first_node = new VersionNode(order_, "0");
+    first_node->setSnapshot(std::make_unique<VersionState_t>());
     order_++;
     current_node_ = new VersionNode(order_, first_node);
     order_++;
@@ -36,10 +45,7 @@ namespace ontologenius {
   void Versionor::insert(Feed_t data)
   {
     if(activated_)
-    {
-      data.checkout_ = true;
-      current_node_->insert(data);
-    }
+      current_node_->insert(encode(data));
   }
 
   bool Versionor::commit(const std::string& id)
@@ -54,13 +60,15 @@ namespace ontologenius {
 
     VersionNode* old_node = current_node_;
     old_node->setId(id);
+    if(needSnapshot(old_node))
+      addSnapshot(old_node);
     current_node_ = new VersionNode(order_, old_node);
     order_++;
     nodes_[old_node->getId()] = old_node;
     return true;
   }
 
-  bool Versionor::checkout(const std::string& id)
+  bool Versionor::checkout(const std::string& id, std::vector<Feed_t>& datas)
   {
     if(!activated_)
       return false;
@@ -72,55 +80,19 @@ namespace ontologenius {
     if(node_it == nodes_.end())
       return false;
 
-    std::vector<VersionNode*> goal_prevs = getPrevs(node_it->second);
-    std::vector<VersionNode*> current_prevs;
-    VersionNode* pivot = current_node_;
-    while(std::find(goal_prevs.begin(), goal_prevs.end(), pivot) == goal_prevs.end())
-    {
-      current_prevs.push_back(pivot);
-      pivot = pivot->getPrev();
-      if(pivot == nullptr)
-        break;
-    }
-
-    if(pivot == nullptr)
-      return false;
-
-    current_prevs.push_back(pivot);
-
-    std::vector<Feed_t> datas;
-    for(auto& current_prev : current_prevs)
-    {
-      if(current_prev == pivot)
-        break;
-      current_prev->appendDatasInvert(datas);
-    }
-
-    bool found_pivot = false;
-    for(auto& goal_prev : goal_prevs)
-    {
-      if(goal_prev == pivot)
-      {
-        found_pivot = true;
-        continue;
-      }
-      else if(found_pivot == false)
-        continue;
-      else
-        goal_prev->appendDatasDirect(datas);
-    }
+    // the states are restored from the closest snapshots
+    datas = getDiff(getState(current_node_), getState(node_it->second));
 
     if(current_node_->defined() == false)
     {
       current_node_->unlinkFromPrev();
+      releaseWords(current_node_);
       delete current_node_;
       current_node_ = nullptr;
     }
 
     current_node_ = new VersionNode(order_, node_it->second);
     order_++;
-    if(storage_ != nullptr)
-      storage_->add(datas);
 
     return true;
   }
@@ -130,7 +102,7 @@ namespace ontologenius {
     if(!activated_)
       return;
 
-    const std::string xml = nodes_["0"]->toXml();
+    const std::string xml = nodes_["0"]->toXml(words_);
 
     if(path.empty())
     {
@@ -150,17 +122,150 @@ namespace ontologenius {
     fclose(file);
   }
 
-  std::vector<VersionNode*> Versionor::getPrevs(VersionNode* from_node)
+  VersionDelta_t Versionor::encode(const Feed_t& data)
+  {
+    VersionDelta_t delta;
+    delta.fact_ = {words_.add(data.from_), words_.add(data.prop_), words_.add(data.on_)};
+    delta.action_ = data.action_;
+    delta.probability_ = (float)data.probability_;
+    delta.stamp_ = data.stamp;
+    return delta;
+  }
+
+  Feed_t Versionor::decode(const VersionFact_t& fact, Action_e action, const VersionFactState_t& state)
+  {
+    Feed_t feed;
+    feed.action_ = action;
+    feed.stamp = state.stamp_;
+    feed.from_ = words_.get(fact.from_);
+    feed.prop_ = words_.get(fact.prop_);
+    feed.on_ = words_.get(fact.on_);
+    feed.probability_ = state.probability_;
+    feed.checkout_ = true;
+    return feed;
+  }
+
+  void Versionor::holdWords(const VersionState_t& state)
+  {
+    for(const auto& fact : state.facts_)
+    {
+      words_.hold(fact.first.from_);
+      words_.hold(fact.first.prop_);
+      words_.hold(fact.first.on_);
+    }
+  }
+
+  void Versionor::releaseWords(const VersionState_t& state)
+  {
+    for(const auto& fact : state.facts_)
+    {
+      words_.remove(fact.first.from_);
+      words_.remove(fact.first.prop_);
+      words_.remove(fact.first.on_);
+    }
+  }
+
+  void Versionor::releaseWords(VersionNode* node)
   {
-    std::vector<VersionNode*> goal_prevs;
-    VersionNode* tmp_prev = from_node;
-    while(tmp_prev != nullptr)
+    for(const auto& delta : node->getDeltas())
     {
-      goal_prevs.push_back(tmp_prev);
-      tmp_prev = tmp_prev->getPrev();
+      words_.remove(delta.fact_.from_);
+      words_.remove(delta.fact_.prop_);
+      words_.remove(delta.fact_.on_);
     }
-    std::reverse(goal_prevs.begin(), goal_prevs.end());
-    return goal_prevs;
+  }
+
+  bool Versionor::needSnapshot(VersionNode* node)
+  {
+    // the depth is computed again each time as the snapshots can be dropped
+    size_t depth = 0;
+    size_t nb_deltas = 0;
+    for(VersionNode* tmp = node; (tmp != nullptr) && (tmp->hasSnapshot() == false); tmp = tmp->getPrev())
+    {
+      depth++;
+      nb_deltas += tmp->size();
+    }
+    return (depth >= VERSION_SNAPSHOT_MAX_DEPTH) || (nb_deltas >= VERSION_SNAPSHOT_MAX_DELTAS);
+  }
+
+  void Versionor::addSnapshot(VersionNode* node)
+  {
+    node->setSnapshot(std::make_unique<VersionState_t>(getState(node)));
+    holdWords(node->getSnapshot());
+    snapshots_.push_back(node);
+    snapshots_size_ += node->getSnapshotSize();
+
+    // Each snapshot is a full state, so the least recently used ones are dropped beyond the bound.
+    // The states of their versions are still computed from the previous snapshots and the deltas.
+    size_t nb_dropped = 0;
+    while((snapshots_size_ > snapshots_max_size_) && (snapshots_.size() - nb_dropped > 1))
+    {
+      snapshots_size_ -= snapshots_[nb_dropped]->getSnapshotSize();
+      releaseWords(snapshots_[nb_dropped]->getSnapshot());
+      snapshots_[nb_dropped]->setSnapshot(nullptr);
+      nb_dropped++;
+    }
+    snapshots_.erase(snapshots_.begin(), snapshots_.begin() + (std::ptrdiff_t)nb_dropped);
+  }
+
+  void Versionor::useSnapshot(VersionNode* node)
+  {
+    auto it = std::find(snapshots_.begin(), snapshots_.end(), node);
+    if(it != snapshots_.end()) // the first node is not in the list and is never dropped
+      std::rotate(it, it + 1, snapshots_.end());
+  }
+
+  VersionState_t Versionor::getState(VersionNode* node)
+  {
+    std::vector<VersionNode*> path;
+    VersionNode* tmp = node;
+    while(tmp->hasSnapshot() == false) // the first node always has one
+    {
+      path.push_back(tmp);
+      tmp = tmp->getPrev();
+    }
+
+    useSnapshot(tmp);
+    VersionState_t state = tmp->getSnapshot();
+    for(auto it = path.rbegin(); it != path.rend(); ++it)
+      (*it)->applyDeltas(state);
+    return state;
+  }
+
+  std::vector<Feed_t> Versionor::getDiff(const VersionState_t& from, const VersionState_t& to)
+  {
+    // The facts only changed in from are set back as before their first change, from the latest one.
+    // The facts changed in to are set as they were last, in the order of these last changes.
+    std::vector<std::pair<size_t, Feed_t>> undone;
+    for(const auto& fact : from.facts_)
+    {
+      if(to.facts_.find(fact.first) == to.facts_.end())
+      {
+        Action_e action = (fact.second.first_action_ == action_add) ? action_del : action_add;
+        undone.emplace_back(fact.second.position_, decode(fact.first, action, fact.second));
+      }
+    }
+
+    std::vector<std::pair<size_t, Feed_t>> done;
+    for(const auto& fact : to.facts_)
+    {
+      auto from_it = from.facts_.find(fact.first);
+      if((from_it == from.facts_.end()) ||
+         (from_it->second.last_action_ != fact.second.last_action_) ||
+         ((fact.second.last_action_ == action_add) && (from_it->second.probability_ != fact.second.probability_)))
+        done.emplace_back(fact.second.position_, decode(fact.first, fact.second.last_action_, fact.second));
+    }
+
+    std::sort(undone.begin(), undone.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+    std::sort(done.begin(), done.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    std::vector<Feed_t> datas;
+    datas.reserve(undone.size() + done.size());
+    for(auto& data : undone)
+      datas.push_back(std::move(data.second));
+    for(auto& data : done)
+      datas.push_back(std::move(data.second));
+    return datas;
   }
 
 } // namespace ontologenius
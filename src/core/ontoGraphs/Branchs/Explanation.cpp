@@ -0,0 +1,90 @@
+#include "ontologenius/core/ontoGraphs/Branchs/Explanation.h"
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ontologenius {
+
+  Explanation ExplanationTable::add(const std::vector<std::string>& facts)
+  {
+    if(facts.empty())
+      return Explanation();
+
+    const std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<label_id_t> key;
+    key.reserve(facts.size());
+    for(const auto& fact : facts)
+      key.push_back(facts_.add(fact));
+
+    auto it = records_.find(key);
+    if(it != records_.end())
+    {
+      // the facts were already referenced by the existing record
+      for(label_id_t fact : key)
+        facts_.unref(fact);
+      it->second.count++;
+      return Explanation(&it->second);
+    }
+
+    it = records_.emplace(std::move(key), ExplanationRecord{this, nullptr, 1}).first;
+    it->second.facts = &it->first;
+    return Explanation(&it->second);
+  }
+
+  Explanation ExplanationTable::copy(const Explanation& explanation)
+  {
+    if((explanation.record_ == nullptr) || (explanation.record_->table == this))
+      return explanation;
+    return add(explanation.getFacts());
+  }
+
+  size_t ExplanationTable::size()
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return records_.size();
+  }
+
+  void ExplanationTable::ref(ExplanationRecord* record)
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    record->count++;
+  }
+
+  void ExplanationTable::unref(ExplanationRecord* record)
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if(--record->count != 0)
+      return;
+
+    for(label_id_t fact : *record->facts)
+      facts_.unref(fact);
+    records_.erase(records_.find(*record->facts));
+  }
+
+  std::vector<std::string> ExplanationTable::getFacts(const ExplanationRecord* record)
+  {
+    std::vector<std::string> res;
+    const std::lock_guard<std::mutex> lock(mutex_);
+    res.reserve(record->facts->size());
+    for(label_id_t fact : *record->facts)
+      res.push_back(facts_.get(fact));
+    return res;
+  }
+
+  std::string ExplanationTable::toString(const ExplanationRecord* record)
+  {
+    std::string res;
+    const std::lock_guard<std::mutex> lock(mutex_);
+    for(label_id_t fact : *record->facts)
+    {
+      if(res.empty() == false)
+        res += ", ";
+      res += facts_.get(fact);
+    }
+    return res;
+  }
+
+} // namespace ontologenius
@@ -9,6 +9,18 @@
 
 namespace ontologenius {
 
+  void IndividualBranch::addIncomingRelation(ObjectPropertyBranch* property, IndividualBranch* subject)
+  {
+    incoming_object_relations_.emplace_back(property, subject);
+  }
+
+  void IndividualBranch::removeIncomingRelation(ObjectPropertyBranch* property, IndividualBranch* subject)
+  {
+    auto it = std::find(incoming_object_relations_.begin(), incoming_object_relations_.end(), std::make_pair(property, subject));
+    if(it != incoming_object_relations_.end())
+      incoming_object_relations_.erase(it);
+  }
+
   int IndividualBranch::objectRelationExists(ObjectPropertyBranch* property, IndividualBranch* individual)
   {
     for(size_t i = 0; i < object_relations_.size(); i++)
@@ -0,0 +1,169 @@
+#include "ontologenius/core/ontoGraphs/Branchs/Labels.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ontologenius {
+
+  LabelTable::LabelTable()
+  {
+    words_.emplace_back(""); // id 0 is reserved for the unknown words
+    counts_.push_back(1);
+  }
+
+  label_id_t LabelTable::add(const std::string& word)
+  {
+    auto it = ids_.find(std::string_view(word));
+    if(it != ids_.end())
+    {
+      counts_[it->second]++;
+      return it->second;
+    }
+
+    label_id_t id = 0;
+    if(free_ids_.empty())
+    {
+      id = (label_id_t)words_.size();
+      words_.push_back(word);
+      counts_.push_back(1);
+    }
+    else
+    {
+      id = free_ids_.back();
+      free_ids_.pop_back();
+      words_[id] = word;
+      counts_[id] = 1;
+    }
+    ids_.emplace(std::string_view(words_[id]), id);
+    return id;
+  }
+
+  label_id_t LabelTable::find(const std::string& word) const
+  {
+    auto it = ids_.find(std::string_view(word));
+    return (it == ids_.end()) ? 0 : it->second;
+  }
+
+  void LabelTable::unref(label_id_t id)
+  {
+    if((id == 0) || (counts_[id] == 0) || (--counts_[id] != 0))
+      return;
+
+    ids_.erase(std::string_view(words_[id]));
+    std::string().swap(words_[id]);
+    free_ids_.push_back(id);
+  }
+
+  Labels::Labels(const Labels& other) : table_(other.table_), labels_(other.labels_)
+  {
+    for(const auto& label : labels_)
+    {
+      table_->ref(label.lang);
+      table_->ref(label.word);
+    }
+  }
+
+  Labels& Labels::operator=(const Labels& other)
+  {
+    if(this == &other)
+      return *this;
+
+    if(table_ == other.table_)
+    {
+      Labels tmp(other);
+      labels_.swap(tmp.labels_);
+    }
+    else
+    {
+      clear();
+      labels_.reserve(other.labels_.size());
+      other.forEach([this](const std::string& lang, const std::string& word) { labels_.push_back({table_->add(lang), table_->add(word)}); });
+    }
+    return *this;
+  }
+
+  Labels& Labels::operator=(Labels&& other)
+  {
+    if(table_ == other.table_)
+      labels_.swap(other.labels_);
+    else
+      *this = other;
+    return *this;
+  }
+
+  Labels& Labels::operator=(const std::map<std::string, std::vector<std::string>>& labels)
+  {
+    clear();
+    for(const auto& lang : labels)
+      for(const auto& word : lang.second)
+        add(lang.first, word);
+    return *this;
+  }
+
+  bool Labels::has(const std::string& lang) const
+  {
+    label_id_t lang_id = table_->find(lang);
+    if(lang_id == 0)
+      return false;
+
+    return std::any_of(labels_.begin(), labels_.end(), [lang_id](const Label_t& label) { return label.lang == lang_id; });
+  }
+
+  bool Labels::has(const std::string& lang, const std::string& word) const
+  {
+    label_id_t lang_id = table_->find(lang);
+    label_id_t word_id = table_->find(word);
+    if((lang_id == 0) || (word_id == 0))
+      return false;
+
+    return std::any_of(labels_.begin(), labels_.end(), [lang_id, word_id](const Label_t& label) { return (label.lang == lang_id) && (label.word == word_id); });
+  }
+
+  std::map<std::string, std::vector<std::string>> Labels::toMap() const
+  {
+    std::map<std::string, std::vector<std::string>> res;
+    forEach([&res](const std::string& lang, const std::string& word) { res[lang].push_back(word); });
+    return res;
+  }
+
+  bool Labels::add(const std::string& lang, const std::string& word)
+  {
+    if(has(lang, word))
+      return false;
+
+    labels_.push_back({table_->add(lang), table_->add(word)});
+    return true;
+  }
+
+  bool Labels::remove(const std::string& lang, const std::string& word)
+  {
+    label_id_t lang_id = table_->find(lang);
+    label_id_t word_id = table_->find(word);
+    if((lang_id == 0) || (word_id == 0))
+      return false;
+
+    auto it = std::find_if(labels_.begin(), labels_.end(), [lang_id, word_id](const Label_t& label) { return (label.lang == lang_id) && (label.word == word_id); });
+    if(it == labels_.end())
+      return false;
+
+    labels_.erase(it); // keeps the order of the remaining words
+    table_->unref(lang_id);
+    table_->unref(word_id);
+    return true;
+  }
+
+  void Labels::clear()
+  {
+    for(const auto& label : labels_)
+    {
+      table_->unref(label.lang);
+      table_->unref(label.word);
+    }
+    std::vector<Label_t>().swap(labels_);
+  }
+
+} // namespace ontologenius
@@ -1,9 +0,0 @@
-#include "ontologenius/core/ontoGraphs/Branchs/LiteralNode.h"
-
-#include "ontologenius/core/ontoGraphs/Branchs/WordTable.h"
-
-namespace ontologenius {
-
-  WordTable LiteralNode::table;
-
-} // namespace ontologenius
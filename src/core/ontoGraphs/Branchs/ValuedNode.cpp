@@ -4,66 +4,34 @@
 #include <string>
 #include <vector>
 
-#include "ontologenius/core/ontoGraphs/Branchs/WordTable.h"
-
 namespace ontologenius {
 
-  WordTable ValuedNode::table;
-
   void ValuedNode::setSteadyDictionary(const std::string& lang, const std::string& word)
   {
-    conditionalPushBack(dictionary_.spoken_[lang], word);
-    conditionalPushBack(steady_dictionary_.spoken_[lang], word);
+    dictionary_.spoken_.add(lang, word);
+    if(steady_dictionary_.spoken_.add(lang, word))
+      flags_.erase("dico"); // the derived labels have to be computed again
   }
 
   void ValuedNode::setSteadyMutedDictionary(const std::string& lang, const std::string& word)
   {
-    conditionalPushBack(dictionary_.muted_[lang], word);
-    conditionalPushBack(steady_dictionary_.muted_[lang], word);
+    dictionary_.muted_.add(lang, word);
+    if(steady_dictionary_.muted_.add(lang, word))
+      flags_.erase("dico"); // the derived labels have to be computed again
   }
 
   void ValuedNode::setSteadyDictionary(const std::map<std::string, std::vector<std::string>>& dictionary)
   {
     for(const auto& it : dictionary)
-    {
-      if(dictionary_.spoken_.find(it.first) == dictionary_.spoken_.end())
-        dictionary_.spoken_[it.first] = it.second;
-      else
-      {
-        for(const auto& name : it.second)
-          conditionalPushBack(dictionary_.spoken_[it.first], name);
-      }
-
-      if(steady_dictionary_.spoken_.find(it.first) == steady_dictionary_.spoken_.end())
-        steady_dictionary_.spoken_[it.first] = it.second;
-      else
-      {
-        for(const auto& name : it.second)
-          conditionalPushBack(steady_dictionary_.spoken_[it.first], name);
-      }
-    }
+      for(const auto& name : it.second)
+        setSteadyDictionary(it.first, name);
   }
 
   void ValuedNode::setSteadyMutedDictionary(const std::map<std::string, std::vector<std::string>>& dictionary)
   {
     for(const auto& it : dictionary)
-    {
-      if(dictionary_.muted_.find(it.first) == dictionary_.muted_.end())
-        dictionary_.muted_[it.first] = it.second;
-      else
-      {
-        for(const auto& name : it.second)
-          conditionalPushBack(dictionary_.muted_[it.first], name);
-      }
-
-      if(steady_dictionary_.muted_.find(it.first) == steady_dictionary_.muted_.end())
-        steady_dictionary_.muted_[it.first] = it.second;
-      else
-      {
-        for(const auto& name : it.second)
-          conditionalPushBack(steady_dictionary_.muted_[it.first], name);
-      }
-    }
+      for(const auto& name : it.second)
+        setSteadyMutedDictionary(it.first, name);
   }
 
 } // namespace ontologenius
@@ -24,26 +24,30 @@ namespace ontologenius {
   AnonymousClassGraph::AnonymousClassGraph(ClassGraph* class_graph,
                                            ObjectPropertyGraph* object_property_graph,
                                            DataPropertyGraph* data_property_graph,
-                                           IndividualGraph* individual_graph) : class_graph_(class_graph),
-                                                                                object_property_graph_(object_property_graph),
-                                                                                data_property_graph_(data_property_graph),
-                                                                                individual_graph_(individual_graph)
+                                           IndividualGraph* individual_graph,
+                                           WordTable* table) : Graph(table),
+                                                               class_graph_(class_graph),
+                                                               object_property_graph_(object_property_graph),
+                                                               data_property_graph_(data_property_graph),
+                                                               individual_graph_(individual_graph)
   {}
 
   AnonymousClassGraph::AnonymousClassGraph(const AnonymousClassGraph& other,
                                            ClassGraph* class_graph,
                                            ObjectPropertyGraph* object_property_graph,
                                            DataPropertyGraph* data_property_graph,
-                                           IndividualGraph* individual_graph) : class_graph_(class_graph),
-                                                                                object_property_graph_(object_property_graph),
-                                                                                data_property_graph_(data_property_graph),
-                                                                                individual_graph_(individual_graph)
+                                           IndividualGraph* individual_graph,
+                                           WordTable* table) : Graph(table),
+                                                               class_graph_(class_graph),
+                                                               object_property_graph_(object_property_graph),
+                                                               data_property_graph_(data_property_graph),
+                                                               individual_graph_(individual_graph)
 
   {
     for(auto* branch : other.all_branchs_)
     {
-      auto* class_branch = new AnonymousClassBranch(branch->value());
-      all_branchs_.push_back(class_branch);
+      auto* class_branch = createBranch(branch->value());
+      insertBranchInVectors(class_branch);
     }
   }
 
@@ -157,11 +161,11 @@ namespace ontologenius {
     const std::lock_guard<std::shared_timed_mutex> lock(Graph<AnonymousClassBranch>::mutex_);
 
     const std::string ano_name = "anonymous_" + value;
-    AnonymousClassBranch* anonymous_branch = new AnonymousClassBranch(ano_name);
+    AnonymousClassBranch* anonymous_branch = createBranch(ano_name);
     ClassBranch* class_branch = class_graph_->findOrCreateBranch(value);
 
     anonymous_branch->class_equiv_ = class_branch;
-    all_branchs_.push_back(anonymous_branch);
+    insertBranchInVectors(anonymous_branch);
     class_branch->equiv_relations_ = anonymous_branch;
 
     for(size_t i = 0; i < ano.equivalence_trees.size(); i++)
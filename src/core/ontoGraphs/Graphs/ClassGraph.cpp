@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "ontologenius/core/ontoGraphs/Branchs/ClassBranch.h"
+#include "ontologenius/core/ontoGraphs/Branchs/DataPropertyBranch.h"
 #include "ontologenius/core/ontoGraphs/Branchs/Elements.h"
 #include "ontologenius/core/ontoGraphs/Branchs/LiteralNode.h"
 #include "ontologenius/core/ontoGraphs/Branchs/ValuedNode.h"
@@ -26,24 +27,31 @@ namespace ontologenius {
 
   ClassGraph::ClassGraph(IndividualGraph* individual_graph,
                          ObjectPropertyGraph* object_property_graph,
-                         DataPropertyGraph* data_property_graph) : OntoGraph(individual_graph),
-                                                                   object_property_graph_(object_property_graph),
-                                                                   data_property_graph_(data_property_graph)
+                         DataPropertyGraph* data_property_graph,
+                         WordTable* table) : OntoGraph(individual_graph, table),
+                                             object_relations_index_(object_property_graph),
+                                             data_relations_index_(data_property_graph),
+                                             object_property_graph_(object_property_graph),
+                                             data_property_graph_(data_property_graph)
   {}
 
   ClassGraph::ClassGraph(const ClassGraph& other,
                          IndividualGraph* individual_graph,
                          ObjectPropertyGraph* object_property_graph,
-                         DataPropertyGraph* data_property_graph) : OntoGraph(individual_graph),
-                                                                   object_property_graph_(object_property_graph),
-                                                                   data_property_graph_(data_property_graph)
+                         DataPropertyGraph* data_property_graph,
+                         WordTable* table) : OntoGraph(individual_graph, table),
+                                             object_relations_index_(object_property_graph),
+                                             data_relations_index_(data_property_graph),
+                                             object_property_graph_(object_property_graph),
+                                             data_property_graph_(data_property_graph)
   {
     language_ = other.language_;
+    deterministic_names_ = other.deterministic_names_;
 
     for(auto* branch : other.all_branchs_)
     {
-      auto* class_branch = new ClassBranch(branch->value());
-      all_branchs_.push_back(class_branch);
+      auto* class_branch = createBranch(branch->value());
+      insertBranchInVectors(class_branch);
     }
 
     this->container_.load(all_branchs_);
@@ -67,6 +75,7 @@ namespace ontologenius {
       conditionalPushBack(mother_branch->childs_, ClassElement(me, mother.probability, true));
       conditionalPushBack(me->mothers_, ClassElement(mother_branch, mother.probability));
     }
+    invalidateClosure();
 
     /**********************
     ** Disjoint assertion
@@ -95,6 +104,7 @@ namespace ontologenius {
 
     me->setSteadyDictionary(object_vector.dictionary_);
     me->setSteadyMutedDictionary(object_vector.muted_dictionary_);
+    labels_.update(me);
 
     mitigate(me);
     return me;
@@ -138,6 +148,7 @@ namespace ontologenius {
     ClassBranch* class_branch = findOrCreateBranch(relation.second);
 
     me->object_relations_.emplace_back(property_branch, class_branch, relation.probability);
+    object_relations_index_.add(property_branch->get(), me, class_branch);
   }
 
   void ClassGraph::addDataRelation(ClassBranch* me, PairElement<std::string, std::string>& relation)
@@ -147,6 +158,7 @@ namespace ontologenius {
 
     auto* literal = data_property_graph_->createLiteral(relation.second);
     me->data_relations_.emplace_back(property_branch, literal, relation.probability);
+    data_relations_index_.add(property_branch->get(), me, literal);
   }
 
   /*********
@@ -165,7 +177,7 @@ namespace ontologenius {
   std::unordered_set<index_t> ClassGraph::getRelationFrom(index_t class_id, int depth)
   {
     const std::shared_lock<std::shared_timed_mutex> lock(Graph<ClassBranch>::mutex_);
-    ClassBranch* class_branch = container_.find(ValuedNode::table.get(class_id));
+    ClassBranch* class_branch = findBranch(class_id);
     return getRelationFrom<index_t>(class_branch, depth);
   }
 
@@ -200,42 +212,26 @@ namespace ontologenius {
 
   std::unordered_set<std::string> ClassGraph::getRelatedFrom(const std::string& property)
   {
-    const std::unordered_set<index_t> object_properties = object_property_graph_->getDownId(property);
-    const std::unordered_set<index_t> data_properties = data_property_graph_->getDownId(property);
-
     std::unordered_set<std::string> res;
-    getRelatedFrom(object_properties, data_properties, res);
+    getRelatedFrom(property, res);
 
     return res;
   }
 
   std::unordered_set<index_t> ClassGraph::getRelatedFrom(index_t property)
   {
-    const std::unordered_set<index_t> object_properties = object_property_graph_->getDownId(property);
-    const std::unordered_set<index_t> data_properties = data_property_graph_->getDownId(property);
-
     std::unordered_set<index_t> res;
-    getRelatedFrom(object_properties, data_properties, res);
+    getRelatedFrom(property, res);
 
     return res;
   }
 
   template<typename T>
-  void ClassGraph::getRelatedFrom(const std::unordered_set<index_t>& object_properties, const std::unordered_set<index_t>& data_properties, std::unordered_set<T>& res)
+  void ClassGraph::getRelatedFrom(const T& property, std::unordered_set<T>& res)
   {
     const std::shared_lock<std::shared_timed_mutex> lock(Graph<ClassBranch>::mutex_);
-    for(auto& branch : all_branchs_)
-    {
-      for(const ClassObjectRelationElement& relation : branch->object_relations_)
-        for(const index_t id : object_properties)
-          if(relation.first->get() == id)
-            getDown(branch, res);
-
-      for(const ClassDataRelationElement& relation : branch->data_relations_)
-        for(const index_t id : data_properties)
-          if(relation.first->get() == id)
-            getDown(branch, res);
-    }
+    object_relations_index_.forEach(property, [this, &res](const auto& relation) { getDown(relation.first, res); });
+    data_relations_index_.forEach(property, [this, &res](const auto& relation) { getDown(relation.first, res); });
   }
 
   std::unordered_set<std::string> ClassGraph::getRelationOn(const std::string& class_name, int depth)
@@ -257,9 +253,9 @@ namespace ontologenius {
     const std::shared_lock<std::shared_timed_mutex> lock(Graph<ClassBranch>::mutex_);
 
     if(class_id > 0)
-      getRelationOnObjectProperties(ValuedNode::table.get(class_id), res, depth);
+      getRelationOnObjectProperties(table_->get(class_id), res, depth);
     else
-      getRelationOnDataProperties(LiteralNode::table.get(-class_id), res, depth);
+      getRelationOnDataProperties(data_property_graph_->literal_table_->get(-class_id), res, depth);
 
     return res;
   }
@@ -299,76 +295,34 @@ namespace ontologenius {
 
   std::unordered_set<std::string> ClassGraph::getRelatedOn(const std::string& property)
   {
-    const std::unordered_set<index_t> object_properties = object_property_graph_->getDownId(property);
-    const std::unordered_set<index_t> data_properties = data_property_graph_->getDownId(property);
-
     std::unordered_set<std::string> res;
     const std::shared_lock<std::shared_timed_mutex> lock(Graph<ClassBranch>::mutex_);
 
-    for(auto& branch : all_branchs_)
-    {
-      for(const ClassObjectRelationElement& relation : branch->object_relations_)
-        for(const index_t id : object_properties)
-          if(relation.first->get() == id)
-            res.insert(relation.second->value());
-
-      for(const ClassDataRelationElement& relation : branch->data_relations_)
-        for(const index_t id : data_properties)
-          if(relation.first->get() == id)
-            res.insert(relation.second->value());
-    }
+    object_relations_index_.forEach(property, [&res](const auto& relation) { res.insert(relation.second->value()); });
+    data_relations_index_.forEach(property, [&res](const auto& relation) { res.insert(relation.second->value()); });
 
     return res;
   }
 
   std::unordered_set<index_t> ClassGraph::getRelatedOn(index_t property)
   {
-    const std::unordered_set<index_t> object_properties = object_property_graph_->getDownId(property);
-    const std::unordered_set<index_t> data_properties = data_property_graph_->getDownId(property);
-
     std::unordered_set<index_t> res;
     const std::shared_lock<std::shared_timed_mutex> lock(Graph<ClassBranch>::mutex_);
 
-    for(auto& branch : all_branchs_)
-    {
-      for(const ClassObjectRelationElement& relation : branch->object_relations_)
-        for(const index_t id : object_properties)
-          if(relation.first->get() == id)
-            res.insert(relation.second->get());
-
-      for(const ClassDataRelationElement& relation : branch->data_relations_)
-        for(const index_t id : data_properties)
-          if(relation.first->get() == id)
-            res.insert(relation.second->get());
-    }
+    object_relations_index_.forEach(property, [&res](const auto& relation) { res.insert(relation.second->get()); });
+    data_relations_index_.forEach(property, [&res](const auto& relation) { res.insert(relation.second->get()); });
 
     return res;
   }
 
   void ClassGraph::getRelatedOnDataProperties(const std::string& property, std::unordered_set<std::string>& res)
   {
-    const std::unordered_set<index_t> data_properties = data_property_graph_->getDownId(property);
-
-    for(auto& branch : all_branchs_)
-    {
-      for(const ClassDataRelationElement& relation : branch->data_relations_)
-        for(const index_t id : data_properties)
-          if(relation.first->get() == id)
-            res.insert(relation.second->value());
-    }
+    data_relations_index_.forEach(property, [&res](const auto& relation) { res.insert(relation.second->value()); });
   }
 
   void ClassGraph::getRelatedOnDataProperties(index_t property, std::unordered_set<index_t>& res)
   {
-    const std::unordered_set<index_t> data_properties = data_property_graph_->getDownId(property);
-
-    for(auto& branch : all_branchs_)
-    {
-      for(const ClassDataRelationElement& relation : branch->data_relations_)
-        for(const index_t id : data_properties)
-          if(relation.first->get() == id)
-            res.insert(relation.second->get());
-    }
+    data_relations_index_.forEach(property, [&res](const auto& relation) { res.insert(relation.second->get()); });
   }
 
   std::unordered_set<std::string> ClassGraph::getRelationWith(const std::string& class_name)
@@ -390,7 +344,7 @@ namespace ontologenius {
   std::unordered_set<index_t> ClassGraph::getRelationWith(index_t class_id)
   {
     std::unordered_set<index_t> res;
-    ClassBranch* class_branch = container_.find(ValuedNode::table.get(class_id));
+    ClassBranch* class_branch = findBranch(class_id);
     if(class_branch != nullptr)
     {
       std::map<index_t, int> properties;
@@ -534,7 +488,7 @@ namespace ontologenius {
     }
 
     for(auto i : do_not_take)
-      res.erase(ValuedNode::table[i]);
+      res.erase((*table_)[i]);
 
     return res;
   }
@@ -547,7 +501,7 @@ namespace ontologenius {
 
     if(class_id > 0)
     {
-      ClassBranch* class_branch = container_.find(ValuedNode::table.get(class_id));
+      ClassBranch* class_branch = findBranch(class_id);
 
       if(class_branch != nullptr)
         for(auto& branch : all_branchs_)
@@ -559,7 +513,7 @@ namespace ontologenius {
     }
     else
     {
-      LiteralNode* literal = data_property_graph_->literal_container_.find(LiteralNode::table.get(-class_id));
+      LiteralNode* literal = data_property_graph_->literal_container_.find(data_property_graph_->literal_table_->get(-class_id));
 
       if(literal != nullptr)
         for(auto& branch : all_branchs_)
@@ -679,8 +633,8 @@ namespace ontologenius {
     }
 
     for(auto i : do_not_take)
-      if(res.find(ValuedNode::table[i]) != res.end())
-        res.erase(ValuedNode::table[i]);
+      if(res.find((*table_)[i]) != res.end())
+        res.erase((*table_)[i]);
 
     return res;
   }
@@ -710,7 +664,7 @@ namespace ontologenius {
     }
     else
     {
-      LiteralNode* literal = data_property_graph_->literal_container_.find(LiteralNode::table.get(-class_id));
+      LiteralNode* literal = data_property_graph_->literal_container_.find(data_property_graph_->literal_table_->get(-class_id));
 
       for(auto& branch : all_branchs_)
       {
@@ -766,7 +720,7 @@ namespace ontologenius {
     std::unordered_set<index_t> res;
     const std::shared_lock<std::shared_timed_mutex> lock(Graph<ClassBranch>::mutex_);
 
-    ClassBranch* class_branch = container_.find(ValuedNode::table.get(class_id));
+    ClassBranch* class_branch = findBranch(class_id);
     getOn(class_branch, object_properties, data_properties, res, 0, found_depth);
 
     return res;
@@ -876,7 +830,7 @@ namespace ontologenius {
     std::unordered_set<ClassBranch*> up_set;
     const std::shared_lock<std::shared_timed_mutex> lock(Graph<ClassBranch>::mutex_);
 
-    up_set.insert(container_.find(ValuedNode::table.get(first_class)));
+    up_set.insert(findBranch(first_class));
     while(up_set.empty() == false)
     {
       std::unordered_set<ClassBranch*> next_step;
@@ -953,7 +907,7 @@ namespace ontologenius {
 
   std::unordered_set<index_t> ClassGraph::getDomainOf(index_t class_id, int depth)
   {
-    ClassBranch* branch = container_.find(ValuedNode::table.get(class_id));
+    ClassBranch* branch = findBranch(class_id);
     std::unordered_set<index_t> res;
     getDomainOf(branch, res, depth);
     return res;
@@ -969,7 +923,7 @@ namespace ontologenius {
 
   std::unordered_set<index_t> ClassGraph::getRangeOf(index_t class_id, int depth)
   {
-    ClassBranch* branch = container_.find(ValuedNode::table.get(class_id));
+    ClassBranch* branch = findBranch(class_id);
     std::unordered_set<index_t> res;
     getRangeOf(branch, res, depth);
     return res;
@@ -1084,11 +1038,16 @@ namespace ontologenius {
   }
 
   void ClassGraph::deleteClass(ClassBranch* class_branch)
+  {
+    const std::lock_guard<std::shared_timed_mutex> lock_indiv(individual_graph_->mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    deleteClassUnsafe(class_branch);
+  }
+
+  void ClassGraph::deleteClassUnsafe(ClassBranch* class_branch)
   {
     if(class_branch != nullptr)
     {
-      const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
-
       // erase indiv from parents
       std::unordered_set<ClassBranch*> up_set;
       getUpPtr(class_branch, up_set, 1);
@@ -1132,12 +1091,18 @@ namespace ontologenius {
       // erase properties applied to class_branch
       const int index = deleteRelationsOnClass(class_branch, all_branchs_);
 
+      for(auto& relation : class_branch->object_relations_)
+        object_relations_index_.remove(relation.first->get(), class_branch, relation.second);
+      for(auto& relation : class_branch->data_relations_)
+        data_relations_index_.remove(relation.first->get(), class_branch, relation.second);
+
       // delete indiv
-      if(index > 0)
-        all_branchs_.erase(all_branchs_.begin() + index);
+      if(index >= 0)
+        removeBranchInVectors(index);
 
       container_.erase(class_branch);
-      delete class_branch;
+      pool_.destroy(class_branch);
+      invalidateClosure();
     }
   }
 
@@ -1151,7 +1116,10 @@ namespace ontologenius {
 
       for(size_t i = 0; i < vect[class_i]->object_relations_.size();)
         if(vect[class_i]->object_relations_[i].second == class_branch)
+        {
+          object_relations_index_.remove(vect[class_i]->object_relations_[i].first->get(), vect[class_i], class_branch);
           vect[class_i]->object_relations_.erase(vect[class_i]->object_relations_.begin() + (int)i);
+        }
         else
           i++;
     }
@@ -1160,30 +1128,36 @@ namespace ontologenius {
 
   bool ClassGraph::addInheritage(const std::string& branch_base, const std::string& branch_inherited)
   {
-    ClassBranch* branch = findBranchSafe(branch_base);
+    // same locking order as the individual graph queries
+    const std::lock_guard<std::shared_timed_mutex> lock_indiv(individual_graph_->mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    return addInheritageUnsafe(branch_base, branch_inherited);
+  }
+
+  bool ClassGraph::addInheritageUnsafe(const std::string& branch_base, const std::string& branch_inherited)
+  {
+    ClassBranch* branch = findBranch(branch_base);
     if(branch != nullptr)
     {
-      ClassBranch* inherited = findBranchSafe(branch_inherited);
-      const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      ClassBranch* inherited = findBranch(branch_inherited);
       if(inherited == nullptr)
       {
-        IndividualBranch* tmp = individual_graph_->findBranchSafe(branch_inherited);
+        IndividualBranch* tmp = individual_graph_->findBranch(branch_inherited);
         if(tmp != nullptr)
           inherited = individual_graph_->upgradeToBranch(tmp);
         else
         {
-          inherited = new ClassBranch(branch_inherited);
+          inherited = createBranch(branch_inherited);
           container_.insert(inherited);
-          all_branchs_.push_back(inherited);
+          insertBranchInVectors(inherited);
         }
       }
       if(OntoGraph::addInheritage(branch, inherited))
       {
         std::unordered_set<IndividualBranch*> down_individuals;
-        const std::lock_guard<std::shared_timed_mutex> lock_indiv(individual_graph_->mutex_);
         getDownIndividualPtr(branch, down_individuals);
         for(auto* indiv : down_individuals)
-          indiv->updated_ = true;
+          individual_graph_->setUpdated(indiv);
         return true;
       }
       else
@@ -1193,37 +1167,47 @@ namespace ontologenius {
       return false;
   }
 
-  void ClassGraph::addRelation(ClassBranch* class_from, const std::string& property, const std::string& class_on)
+  void ClassGraph::addRelation(ClassBranch* class_from, const std::string& property, const std::string& class_on, double proba)
+  {
+    const std::shared_lock<std::shared_timed_mutex> lock_indiv(individual_graph_->mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock_object(object_property_graph_->mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock_data(data_property_graph_->mutex_);
+    addRelationUnsafe(class_from, property, class_on, proba);
+  }
+
+  void ClassGraph::addRelationUnsafe(ClassBranch* class_from, const std::string& property, const std::string& class_on, double proba)
   {
     ClassBranch* branch_from = class_from;
     if(branch_from != nullptr)
     {
-      ClassBranch* branch_on = findBranchSafe(class_on);
-      const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      ClassBranch* branch_on = findBranch(class_on);
       if(branch_on == nullptr)
       {
-        IndividualBranch* test = individual_graph_->findBranchSafe(class_on);
+        IndividualBranch* test = individual_graph_->findBranch(class_on);
         if(test != nullptr)
           throw GraphException("object class does not exists");
 
-        branch_on = new ClassBranch(class_on);
+        branch_on = createBranch(class_on);
         container_.insert(branch_on);
-        all_branchs_.push_back(branch_on);
+        insertBranchInVectors(branch_on);
       }
 
-      ObjectPropertyBranch* branch_prop = object_property_graph_->findBranchSafe(property);
+      ObjectPropertyBranch* branch_prop = object_property_graph_->findBranch(property);
       if(branch_prop == nullptr)
       {
-        DataPropertyBranch* test = data_property_graph_->findBranchSafe(property);
+        DataPropertyBranch* test = data_property_graph_->findBranch(property);
         if(test != nullptr)
           throw GraphException(property + " is a data property");
 
-        const std::lock_guard<std::shared_timed_mutex> lock_property(object_property_graph_->mutex_);
         branch_prop = object_property_graph_->newDefaultBranch(property);
       }
 
       if(checkRangeAndDomain(branch_from, branch_prop, branch_on))
-        conditionalPushBack(branch_from->object_relations_, ClassObjectRelationElement(branch_prop, branch_on));
+      {
+        if(conditionalPushBack(branch_from->object_relations_, ClassObjectRelationElement(branch_prop, branch_on, proba)))
+          object_relations_index_.add(branch_prop->get(), branch_from, branch_on);
+      }
       else
         throw GraphException("Inconsistency prevented regarding the range or domain of the property");
     }
@@ -1231,26 +1215,36 @@ namespace ontologenius {
       throw GraphException("The class to apply the relation does not exist");
   }
 
-  void ClassGraph::addRelation(ClassBranch* class_from, const std::string& property, const std::string& type, const std::string& data)
+  void ClassGraph::addRelation(ClassBranch* class_from, const std::string& property, const std::string& type, const std::string& data, double proba)
+  {
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock_object(object_property_graph_->mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock_data(data_property_graph_->mutex_);
+    addRelationUnsafe(class_from, property, type, data, proba);
+  }
+
+  void ClassGraph::addRelationUnsafe(ClassBranch* class_from, const std::string& property, const std::string& type, const std::string& data, double proba)
   {
     ClassBranch* branch_from = class_from;
     if(branch_from != nullptr)
     {
-      LiteralNode* literal_branch = data_property_graph_->createLiteral(type + "#" + data);
+      LiteralNode* literal_branch = data_property_graph_->createLiteralUnsafe(type + "#" + data);
 
-      DataPropertyBranch* branch_prop = data_property_graph_->findBranchSafe(property);
+      DataPropertyBranch* branch_prop = data_property_graph_->findBranch(property);
       if(branch_prop == nullptr)
       {
-        ObjectPropertyBranch* test = object_property_graph_->findBranchSafe(property);
+        ObjectPropertyBranch* test = object_property_graph_->findBranch(property);
         if(test != nullptr)
           throw GraphException(property + " is an object property");
 
-        const std::lock_guard<std::shared_timed_mutex> lock_property(data_property_graph_->mutex_);
         branch_prop = data_property_graph_->newDefaultBranch(property);
       }
 
       if(checkRangeAndDomain(branch_from, branch_prop, literal_branch))
-        conditionalPushBack(branch_from->data_relations_, ClassDataRelationElement(branch_prop, literal_branch));
+      {
+        if(conditionalPushBack(branch_from->data_relations_, ClassDataRelationElement(branch_prop, literal_branch, proba)))
+          data_relations_index_.add(branch_prop->get(), branch_from, literal_branch);
+      }
       else
         throw GraphException("Inconsistency prevented regarding the range or domain of the property");
     }
@@ -1258,37 +1252,47 @@ namespace ontologenius {
       throw GraphException("The class to apply the relation does not exist");
   }
 
-  void ClassGraph::addRelationInvert(const std::string& class_from, const std::string& property, ClassBranch* class_on)
+  void ClassGraph::addRelationInvert(const std::string& class_from, const std::string& property, ClassBranch* class_on, double proba)
+  {
+    const std::shared_lock<std::shared_timed_mutex> lock_indiv(individual_graph_->mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock_object(object_property_graph_->mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock_data(data_property_graph_->mutex_);
+    addRelationInvertUnsafe(class_from, property, class_on, proba);
+  }
+
+  void ClassGraph::addRelationInvertUnsafe(const std::string& class_from, const std::string& property, ClassBranch* class_on, double proba)
   {
     ClassBranch* branch_on = class_on;
     if(branch_on != nullptr)
     {
-      ClassBranch* branch_from = findBranchSafe(class_from);
-      const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      ClassBranch* branch_from = findBranch(class_from);
       if(branch_from == nullptr)
       {
-        IndividualBranch* test = individual_graph_->findBranchSafe(class_from);
+        IndividualBranch* test = individual_graph_->findBranch(class_from);
         if(test != nullptr)
           throw GraphException("The class to apply the relation does not exist");
 
-        branch_from = new ClassBranch(class_from);
+        branch_from = createBranch(class_from);
         container_.insert(branch_from);
-        all_branchs_.push_back(branch_from);
+        insertBranchInVectors(branch_from);
       }
 
-      ObjectPropertyBranch* branch_prop = object_property_graph_->findBranchSafe(property);
+      ObjectPropertyBranch* branch_prop = object_property_graph_->findBranch(property);
       if(branch_prop == nullptr)
       {
-        DataPropertyBranch* test = data_property_graph_->findBranchSafe(property);
+        DataPropertyBranch* test = data_property_graph_->findBranch(property);
         if(test != nullptr)
           throw GraphException(property + " is a data property");
 
-        const std::lock_guard<std::shared_timed_mutex> lock_property(object_property_graph_->mutex_);
         branch_prop = object_property_graph_->newDefaultBranch(property);
       }
 
       if(checkRangeAndDomain(branch_from, branch_prop, branch_on))
-        conditionalPushBack(branch_from->object_relations_, ClassObjectRelationElement(branch_prop, branch_on));
+      {
+        if(conditionalPushBack(branch_from->object_relations_, ClassObjectRelationElement(branch_prop, branch_on, proba)))
+          object_relations_index_.add(branch_prop->get(), branch_from, branch_on);
+      }
       else
         throw GraphException("Inconsistency prevented regarding the range or domain of the property");
     }
@@ -1298,7 +1302,13 @@ namespace ontologenius {
 
   void ClassGraph::removeRelation(const std::string& class_from, const std::string& property, const std::string& class_on)
   {
-    ClassBranch* branch_from = findBranchSafe(class_from);
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    removeRelationUnsafe(class_from, property, class_on);
+  }
+
+  void ClassGraph::removeRelationUnsafe(const std::string& class_from, const std::string& property, const std::string& class_on)
+  {
+    ClassBranch* branch_from = findBranch(class_from);
     if(branch_from != nullptr)
     {
       for(size_t i = 0; i < branch_from->object_relations_.size();)
@@ -1307,9 +1317,10 @@ namespace ontologenius {
         {
           if((class_on == "_") || (branch_from->object_relations_[i].second->value() == class_on))
           {
-            branch_from->object_relations_[i].second->updated_ = true;
+            setUpdated(branch_from->object_relations_[i].second);
+            object_relations_index_.remove(branch_from->object_relations_[i].first->get(), branch_from, branch_from->object_relations_[i].second);
             branch_from->object_relations_.erase(branch_from->object_relations_.begin() + (int)i);
-            branch_from->updated_ = true;
+            setUpdated(branch_from);
           }
           else
             i++;
@@ -1324,7 +1335,13 @@ namespace ontologenius {
 
   void ClassGraph::removeRelation(const std::string& class_from, const std::string& property, const std::string& type, const std::string& data)
   {
-    ClassBranch* branch_from = findBranchSafe(class_from);
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    removeRelationUnsafe(class_from, property, type, data);
+  }
+
+  void ClassGraph::removeRelationUnsafe(const std::string& class_from, const std::string& property, const std::string& type, const std::string& data)
+  {
+    ClassBranch* branch_from = findBranch(class_from);
     if(branch_from != nullptr)
     {
       for(size_t i = 0; i < branch_from->data_relations_.size();)
@@ -1334,8 +1351,9 @@ namespace ontologenius {
           if(((type == "_") || (branch_from->data_relations_[i].second->type_ == type)) &&
              ((data == "_") || (branch_from->data_relations_[i].second->value_ == data)))
           {
+            data_relations_index_.remove(branch_from->data_relations_[i].first->get(), branch_from, branch_from->data_relations_[i].second);
             branch_from->data_relations_.erase(branch_from->data_relations_.begin() + (int)i);
-            branch_from->updated_ = true;
+            setUpdated(branch_from);
           }
           else
             i++;
@@ -1348,6 +1366,12 @@ namespace ontologenius {
       throw GraphException("The subject class does not exist");
   }
 
+  void ClassGraph::updateRelationIndexesUnsafe()
+  {
+    object_relations_index_.update();
+    data_relations_index_.update();
+  }
+
   std::pair<bool, ClassBranch*> ClassGraph::checkDomainOrRange(const std::unordered_set<ClassBranch*>& domain_or_range, const std::unordered_set<ClassBranch*>& classes)
   {
     ClassBranch* intersection = firstIntersection(classes, domain_or_range);
@@ -1427,10 +1451,9 @@ namespace ontologenius {
     }
 
     // RANGE
-    std::unordered_set<std::string> range = data_property_graph_->getRange(prop->value());
-    if(range.empty() == false)
+    if(prop->ranges_.empty() == false)
     {
-      if(range.find(data->type_) == range.end())
+      if(std::none_of(prop->ranges_.begin(), prop->ranges_.end(), [data](LiteralNode* range) { return range->type_ == data->type_; }))
         return false;
     }
 
@@ -1455,14 +1478,9 @@ namespace ontologenius {
     for(const auto& child : old_branch->childs_)
       new_branch->childs_.emplace_back(child, container_.find(child.elem->value()));
 
+    // the traces are moved on the copied triplets by the ontology once all the graphs are copied
     for(const auto& mother : old_branch->mothers_)
-    {
-      // inferred inheritance using traces should not be copied but recomputed
-      if(mother.inferred && (mother.induced_traces.empty() == false))
-        new_branch->updated_ = true;
-      else
-        new_branch->mothers_.emplaceBack(mother, container_.find(mother.elem->value()));
-    }
+      new_branch->mothers_.emplaceBack(mother, container_.find(mother.elem->value()));
 
     for(const auto& disjoint : old_branch->disjoints_)
       new_branch->disjoints_.emplace_back(disjoint, container_.find(disjoint.elem->value()));
@@ -1475,13 +1493,15 @@ namespace ontologenius {
       auto* prop = object_property_graph_->container_.find(relation.first->value());
       auto* on = container_.find(relation.second->value());
       new_branch->object_relations_.emplace_back(relation, prop, on);
+      object_relations_index_.add(prop->get(), new_branch, on);
     }
 
     for(const auto& relation : old_branch->data_relations_)
     {
       auto* prop = data_property_graph_->container_.find(relation.first->value());
-      auto* data = relation.second;
+      auto* data = data_property_graph_->literal_container_.find(relation.second->value());
       new_branch->data_relations_.emplace_back(relation, prop, data);
+      data_relations_index_.add(prop->get(), new_branch, data);
     }
   }
 
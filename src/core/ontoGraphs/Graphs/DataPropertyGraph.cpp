@@ -21,24 +21,43 @@
 namespace ontologenius {
 
   DataPropertyGraph::DataPropertyGraph(IndividualGraph* individual_graph,
-                                       ClassGraph* class_graph) : OntoGraph(individual_graph),
-                                                                  class_graph_(class_graph)
+                                       ClassGraph* class_graph,
+                                       WordTable* table,
+                                       WordTable* literal_table) : OntoGraph(individual_graph, table),
+                                                                   class_graph_(class_graph),
+                                                                   literal_table_(literal_table)
   {}
 
   DataPropertyGraph::DataPropertyGraph(const DataPropertyGraph& other,
                                        IndividualGraph* individual_graph,
-                                       ClassGraph* class_graph) : OntoGraph(individual_graph),
-                                                                  class_graph_(class_graph)
+                                       ClassGraph* class_graph,
+                                       WordTable* table,
+                                       WordTable* literal_table) : OntoGraph(individual_graph, table),
+                                                                   class_graph_(class_graph),
+                                                                   literal_table_(literal_table)
   {
     language_ = other.language_;
+    deterministic_names_ = other.deterministic_names_;
 
     for(const auto& branch : other.all_branchs_)
     {
-      auto* prop_branch = new DataPropertyBranch(branch->value());
-      all_branchs_.push_back(prop_branch);
+      auto* prop_branch = createBranch(branch->value());
+      insertBranchInVectors(prop_branch);
     }
 
     this->container_.load(all_branchs_);
+
+    for(auto* literal : other.all_literals_)
+      all_literals_.push_back(literal_pool_.create(literal->value(), literal_table_));
+
+    literal_container_.load(all_literals_);
+  }
+
+  DataPropertyGraph::~DataPropertyGraph()
+  {
+    for(auto* literal : all_literals_)
+      literal_pool_.destroy(literal);
+    all_literals_.clear();
   }
 
   DataPropertyBranch* DataPropertyGraph::add(const std::string& value, DataPropertyVectors_t& property_vectors)
@@ -57,6 +76,7 @@ namespace ontologenius {
       conditionalPushBack(mother_branch->childs_, DataPropertyElement(me, mother.probability, true));
       conditionalPushBack(me->mothers_, DataPropertyElement(mother_branch, mother.probability));
     }
+    invalidateClosure();
 
     /**********************
     ** Disjoints
@@ -98,6 +118,7 @@ namespace ontologenius {
     me->annotation_usage_ = me->annotation_usage_ || property_vectors.annotation_usage_;
     me->setSteadyDictionary(property_vectors.dictionary_);
     me->setSteadyMutedDictionary(property_vectors.muted_dictionary_);
+    labels_.update(me);
 
     mitigate(me);
     return me;
@@ -187,8 +208,13 @@ namespace ontologenius {
     if(literal == nullptr)
     {
       const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
-      literal = new LiteralNode(value);
-      literal_container_.insert(literal);
+      literal = literal_container_.find(value);
+      if(literal == nullptr)
+      {
+        literal = literal_pool_.create(value, literal_table_);
+        all_literals_.push_back(literal);
+        literal_container_.insert(literal);
+      }
     }
     return literal;
   }
@@ -200,7 +226,8 @@ namespace ontologenius {
 
     if(literal == nullptr)
     {
-      literal = new LiteralNode(value);
+      literal = literal_pool_.create(value, literal_table_);
+      all_literals_.push_back(literal);
       literal_container_.insert(literal);
     }
     return literal;
@@ -224,7 +251,7 @@ namespace ontologenius {
     std::unordered_set<index_t> res;
     const std::shared_lock<std::shared_timed_mutex> lock(Graph<DataPropertyBranch>::mutex_);
 
-    DataPropertyBranch* branch = container_.find(ValuedNode::table.get(value));
+    DataPropertyBranch* branch = findBranch(value);
     std::unordered_set<DataPropertyBranch*> up_trace;
     if(branch != nullptr)
       getDomain(branch, depth, res, up_trace);
@@ -278,7 +305,7 @@ namespace ontologenius {
     std::unordered_set<index_t> res;
     const std::shared_lock<std::shared_timed_mutex> lock(Graph<DataPropertyBranch>::mutex_);
 
-    DataPropertyBranch* branch = container_.find(ValuedNode::table.get(value));
+    DataPropertyBranch* branch = findBranch(value);
     if(branch != nullptr)
       for(auto& range : branch->ranges_)
         res.insert(range->get());
@@ -306,8 +333,8 @@ namespace ontologenius {
   std::string DataPropertyGraph::getLiteralIdentifier(index_t index)
   {
     const std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    if((index < 0) && (index > (index_t)LiteralNode::table.size()))
-      return LiteralNode::table[-index];
+    if((index < 0) && (-index < (index_t)literal_table_->size()))
+      return (*literal_table_)[-index];
     else
       return "";
   }
@@ -315,7 +342,15 @@ namespace ontologenius {
   std::vector<std::string> DataPropertyGraph::getLiteralIdentifiers(const std::vector<index_t>& indexes)
   {
     std::vector<std::string> res;
-    std::transform(indexes.cbegin(), indexes.cend(), std::back_inserter(res), [this](const auto& index) { return getLiteralIdentifier(index); });
+    res.reserve(indexes.size());
+    const std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    for(auto index : indexes)
+    {
+      if((index < 0) && (-index < (index_t)literal_table_->size()))
+        res.push_back((*literal_table_)[-index]);
+      else
+        res.emplace_back();
+    }
     return res;
   }
 
@@ -340,7 +375,8 @@ namespace ontologenius {
     for(const auto& mother : old_branch->mothers_)
       new_branch->mothers_.emplaceBack(mother, container_.find(mother.elem->value()));
 
-    new_branch->ranges_ = old_branch->ranges_;
+    for(auto* range : old_branch->ranges_)
+      new_branch->ranges_.push_back(literal_container_.find(range->value()));
 
     for(const auto& domain : old_branch->domains_)
       new_branch->domains_.emplace_back(domain, class_graph_->container_.find(domain.elem->value()));
@@ -31,26 +31,30 @@ namespace ontologenius {
 
   IndividualGraph::IndividualGraph(ClassGraph* class_graph,
                                    ObjectPropertyGraph* object_property_graph,
-                                   DataPropertyGraph* data_property_graph) : class_graph_(class_graph),
-                                                                             object_property_graph_(object_property_graph),
-                                                                             data_property_graph_(data_property_graph)
+                                   DataPropertyGraph* data_property_graph,
+                                   WordTable* table) : Graph(table),
+                                                       object_relations_index_(object_property_graph),
+                                                       data_relations_index_(data_property_graph),
+                                                       class_graph_(class_graph),
+                                                       object_property_graph_(object_property_graph),
+                                                       data_property_graph_(data_property_graph)
   {}
 
   IndividualGraph::IndividualGraph(const IndividualGraph& other,
                                    ClassGraph* class_graph, ObjectPropertyGraph* object_property_graph,
-                                   DataPropertyGraph* data_property_graph) : class_graph_(class_graph),
-                                                                             object_property_graph_(object_property_graph),
-                                                                             data_property_graph_(data_property_graph)
+                                   DataPropertyGraph* data_property_graph,
+                                   WordTable* table) : Graph(table),
+                                                       object_relations_index_(object_property_graph),
+                                                       data_relations_index_(data_property_graph),
+                                                       class_graph_(class_graph),
+                                                       object_property_graph_(object_property_graph),
+                                                       data_property_graph_(data_property_graph)
   {
     language_ = other.language_;
+    deterministic_names_ = other.deterministic_names_;
 
-    std::transform(other.all_branchs_.cbegin(), other.all_branchs_.cend(), std::back_inserter(all_branchs_), [](auto indiv) { return new IndividualBranch(indiv->value()); });
-    for(auto* individual : all_branchs_)
-    {
-      if((size_t)individual->get() >= ordered_individuals_.size())
-        ordered_individuals_.resize(individual->get() + 1, nullptr);
-      ordered_individuals_[individual->get()] = individual;
-    }
+    for(auto* indiv : other.all_branchs_)
+      insertBranchInVectors(createBranch(indiv->value()));
 
     container_.load(all_branchs_);
   }
@@ -63,7 +67,7 @@ namespace ontologenius {
     bool is_new = false;
     if(me == nullptr)
     {
-      me = new IndividualBranch(value);
+      me = createBranch(value);
       insertBranchInVectors(me);
       container_.insert(me);
       is_new = true;
@@ -109,6 +113,7 @@ namespace ontologenius {
 
     me->setSteadyDictionary(individual_vector.dictionary_);
     me->setSteadyMutedDictionary(individual_vector.muted_dictionary_);
+    labels_.update(me);
 
     return me;
   }
@@ -142,7 +147,7 @@ namespace ontologenius {
           // I create my distinct
           if(!i_find_my_distinct)
           {
-            auto* my_distinct = new IndividualBranch(distinct[distinct_j]);
+            auto* my_distinct = createBranch(distinct[distinct_j]);
             conditionalPushBack(me->distinct_, IndividualElement(my_distinct));
             insertBranchInVectors(my_distinct);
             container_.insert(my_distinct);
@@ -189,7 +194,7 @@ namespace ontologenius {
       else
       {
         // I create my same
-        auto* my_same = new IndividualBranch(same_as.elem);
+        auto* my_same = createBranch(same_as.elem);
 
         if(is_new == false)
         {
@@ -219,6 +224,7 @@ namespace ontologenius {
     IndividualBranch* indiv_branch = findOrCreateBranch(relation.second);
 
     me->object_relations_.emplaceBack(property_branch, indiv_branch, relation.probability);
+    indexObjectRelation(me, property_branch, indiv_branch);
   }
 
   void IndividualGraph::addDataRelation(IndividualBranch* me, PairElement<std::string, std::string>& relation)
@@ -227,6 +233,7 @@ namespace ontologenius {
     LiteralNode* literal = data_property_graph_->createLiteral(relation.second);
 
     me->data_relations_.emplaceBack(property_branch, literal, relation.probability);
+    data_relations_index_.add(property_branch->get(), me, literal);
   }
 
   /*********
@@ -242,20 +249,20 @@ namespace ontologenius {
 
   std::unordered_set<index_t> IndividualGraph::getSame(index_t individual)
   {
-    return getSameId(getIndividualByIndex(individual));
+    return getSameId(findBranch(individual));
   }
 
   std::unordered_set<std::string> IndividualGraph::getDistincts(const std::string& individual)
   {
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
     IndividualBranch* indiv = container_.find(individual);
     return getDistincts<std::string>(indiv);
   }
 
   std::unordered_set<index_t> IndividualGraph::getDistincts(index_t individual)
   {
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
-    return getDistincts<index_t>(getIndividualByIndex(individual));
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    return getDistincts<index_t>(findBranch(individual));
   }
 
   template<typename T>
@@ -270,15 +277,15 @@ namespace ontologenius {
 
   std::unordered_set<std::string> IndividualGraph::getRelationFrom(const std::string& individual, int depth)
   {
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
     IndividualBranch* indiv = container_.find(individual);
     return getRelationFrom<std::string>(indiv, depth);
   }
 
   std::unordered_set<index_t> IndividualGraph::getRelationFrom(index_t individual, int depth)
   {
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
-    return getRelationFrom<index_t>(getIndividualByIndex(individual), depth);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    return getRelationFrom<index_t>(findBranch(individual), depth);
   }
 
   template<typename T>
@@ -332,24 +339,19 @@ namespace ontologenius {
   template<typename T>
   std::unordered_set<T> IndividualGraph::getRelatedFrom(const T& property)
   {
-    std::unordered_set<index_t> object_properties = object_property_graph_->getDownId(property);
-    const std::unordered_set<index_t> data_properties = data_property_graph_->getDownId(property);
-
     std::unordered_set<T> class_res;
-    class_graph_->getRelatedFrom(object_properties, data_properties, class_res);
+    class_graph_->getRelatedFrom(property, class_res);
 
     std::unordered_set<T> res;
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
-    for(auto& individual : all_branchs_)
-    {
-      for(const IndivObjectRelationElement& relation : individual->object_relations_)
-        if(std::any_of(object_properties.begin(), object_properties.end(), [prop_id = relation.first->get()](auto& id) { return id == prop_id; }))
-          getSame(individual, res);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    object_relations_index_.forEach(property, [this, &res](const auto& relation) { getSame(relation.first, res); });
+    data_relations_index_.forEach(property, [this, &res](const auto& relation) { getSame(relation.first, res); });
 
-      for(const IndivDataRelationElement& relation : individual->data_relations_)
-        if(std::any_of(object_properties.begin(), object_properties.end(), [prop_id = relation.first->get()](auto& id) { return id == prop_id; }))
-          getSame(individual, res);
+    if(class_res.empty())
+      return res;
 
+    for(auto& individual : all_branchs_)
+    {
       std::unordered_set<T> up_set;
       getUp(individual, up_set, 1);
       for(auto& up : up_set)
@@ -366,13 +368,15 @@ namespace ontologenius {
   std::unordered_set<std::string> IndividualGraph::getRelationOn(const std::string& individual, int depth)
   {
     std::unordered_set<std::string> res;
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
     const std::unordered_set<index_t> same = getSameId(individual);
     for(const index_t id : same)
-      for(auto& indiv : all_branchs_)
-        for(const IndivObjectRelationElement& relation : indiv->object_relations_)
-          if(relation.second->get() == id)
-            object_property_graph_->getUpSafe(relation.first, res, depth);
+    {
+      IndividualBranch* indiv = findBranch(id);
+      if(indiv != nullptr)
+        for(auto& incoming : indiv->incoming_object_relations_)
+          object_property_graph_->getUpSafe(incoming.first, res, depth);
+    }
 
     if(res.empty())
     {
@@ -393,16 +397,18 @@ namespace ontologenius {
   std::unordered_set<index_t> IndividualGraph::getRelationOn(index_t individual, int depth)
   {
     std::unordered_set<index_t> res;
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
 
     if(individual > 0)
     {
       const std::unordered_set<index_t> same = getSameId(individual);
       for(const index_t id : same)
-        for(auto& indiv : all_branchs_)
-          for(const IndivObjectRelationElement& relation : indiv->object_relations_)
-            if(relation.second->get() == id)
-              object_property_graph_->getUpSafe(relation.first, res, depth);
+      {
+        IndividualBranch* indiv = findBranch(id);
+        if(indiv != nullptr)
+          for(auto& incoming : indiv->incoming_object_relations_)
+            object_property_graph_->getUpSafe(incoming.first, res, depth);
+      }
     }
     else
     {
@@ -411,7 +417,7 @@ namespace ontologenius {
           if(relation.second->get() == individual)
             data_property_graph_->getUpSafe(relation.first, res, depth);
 
-      class_graph_->getRelationOnDataProperties(LiteralNode::table.get(-individual), res, depth);
+      class_graph_->getRelationOnDataProperties(data_property_graph_->literal_table_->get(-individual), res, depth);
     }
 
     return res;
@@ -420,7 +426,7 @@ namespace ontologenius {
   std::unordered_set<std::string> IndividualGraph::getRelatedOn(const std::string& property)
   {
     std::unordered_set<std::string> res;
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
 
     getRelatedOn(property, res);
 
@@ -430,7 +436,7 @@ namespace ontologenius {
   std::unordered_set<index_t> IndividualGraph::getRelatedOn(index_t property)
   {
     std::unordered_set<index_t> res;
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
 
     getRelatedOn(property, res);
 
@@ -440,21 +446,8 @@ namespace ontologenius {
   template<typename T>
   void IndividualGraph::getRelatedOn(const T& property, std::unordered_set<T>& res)
   {
-    const std::unordered_set<index_t> object_properties = object_property_graph_->getDownId(property);
-    const std::unordered_set<index_t> data_properties = data_property_graph_->getDownId(property);
-
-    for(auto& indiv : all_branchs_)
-    {
-      for(const IndivObjectRelationElement& relation : indiv->object_relations_)
-        for(const index_t id : object_properties)
-          if(relation.first->get() == id)
-            getSame(relation.second, res);
-
-      for(const IndivDataRelationElement& relation : indiv->data_relations_)
-        for(const index_t id : data_properties)
-          if(relation.first->get() == id)
-            insert(res, relation.second);
-    }
+    object_relations_index_.forEach(property, [this, &res](const auto& relation) { getSame(relation.second, res); });
+    data_relations_index_.forEach(property, [this, &res](const auto& relation) { insert(res, relation.second); });
 
     class_graph_->getRelatedOnDataProperties(property, res);
   }
@@ -467,7 +460,7 @@ namespace ontologenius {
     std::vector<int> depths;
     std::vector<std::string> tmp_res;
 
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
 
     IndividualBranch* indiv = container_.find(individual);
     if(indiv != nullptr)
@@ -513,9 +506,9 @@ namespace ontologenius {
     std::vector<int> depths;
     std::vector<index_t> tmp_res;
 
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
 
-    IndividualBranch* indiv = getIndividualByIndex(individual);
+    IndividualBranch* indiv = findBranch(individual);
     if(indiv != nullptr)
     {
       std::unordered_set<IndividualBranch*> sames;
@@ -554,7 +547,7 @@ namespace ontologenius {
   std::unordered_set<std::string> IndividualGraph::getRelatedWith(const std::string& individual)
   {
     std::unordered_set<std::string> res;
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
 
     index_t indiv_index = 0;
     auto* indiv_ptr = container_.find(individual);
@@ -582,7 +575,7 @@ namespace ontologenius {
   std::unordered_set<index_t> IndividualGraph::getRelatedWith(index_t individual)
   {
     std::unordered_set<index_t> res;
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
 
     getRelatedWith(individual, res);
 
@@ -716,7 +709,27 @@ namespace ontologenius {
     const std::unordered_set<index_t> object_properties = object_property_graph_->getDownId(property);
     const std::unordered_set<index_t> data_properties = data_property_graph_->getDownId(property);
 
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+
+    std::unordered_set<index_t> down_classes;
+    if(individual > 0)
+      down_classes = class_graph_->getDownId(individual);
+
+    if((individual > 0) && down_classes.empty())
+    {
+      // Without class-level relations to consider, only the relations pointing on the individual can match
+      IndividualBranch* indiv_on = findBranch(individual);
+      if(indiv_on != nullptr)
+        for(auto& incoming : indiv_on->incoming_object_relations_)
+          if(object_properties.find(incoming.first->get()) != object_properties.end())
+          {
+            if(single_same)
+              getLowestSame(incoming.second, res);
+            else
+              getSame(incoming.second, res);
+          }
+      return;
+    }
 
     for(auto& indiv_i : all_branchs_)
     {
@@ -749,9 +762,6 @@ namespace ontologenius {
 
       if(found == false)
       {
-        std::unordered_set<index_t> down_classes;
-        if(individual > 0)
-          down_classes = class_graph_->getDownId(individual);
         std::unordered_set<index_t> do_not_take;
 
         std::unordered_set<ClassBranch*> up_set;
@@ -838,7 +848,7 @@ namespace ontologenius {
 
   std::unordered_set<std::string> IndividualGraph::getOn(const std::string& individual, const std::string& property, bool single_same)
   {
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
     IndividualBranch* indiv = container_.find(individual);
 
     return getOn(indiv, property, single_same);
@@ -846,8 +856,8 @@ namespace ontologenius {
 
   std::unordered_set<index_t> IndividualGraph::getOn(index_t individual, index_t property, bool single_same)
   {
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
-    IndividualBranch* indiv = getIndividualByIndex(individual);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    IndividualBranch* indiv = findBranch(individual);
 
     return getOn(indiv, property, single_same);
   }
@@ -947,7 +957,7 @@ namespace ontologenius {
   std::unordered_set<std::string> IndividualGraph::getWith(const std::string& first_individual, const std::string& second_individual, int depth)
   {
     std::unordered_set<std::string> res;
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
     IndividualBranch* indiv = container_.find(first_individual);
 
     std::unordered_set<index_t> second_individual_index;
@@ -979,22 +989,15 @@ namespace ontologenius {
   std::unordered_set<index_t> IndividualGraph::getWith(index_t first_individual, index_t second_individual, int depth)
   {
     std::unordered_set<index_t> res;
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
-    IndividualBranch* indiv = getIndividualByIndex(first_individual);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    IndividualBranch* indiv = findBranch(first_individual);
     if(second_individual > 0)
     {
-      if((size_t)second_individual >= ordered_individuals_.size())
-      {
+      IndividualBranch* second = findBranch(second_individual);
+      if((second == nullptr) || (second->same_as_.empty()))
         getWith(indiv, {second_individual}, res, depth); // class
-      }
       else
-      {
-        IndividualBranch* second = getIndividualByIndex(second_individual);
-        if((second == nullptr) || (second->same_as_.empty()))
-          getWith(indiv, {second_individual}, res, depth); // class
-        else
-          getWith(indiv, getSameId(second), res, depth);
-      }
+        getWith(indiv, getSameId(second), res, depth);
     }
     else
       getWith(indiv, {second_individual}, res, depth); // literal
@@ -1069,7 +1072,7 @@ namespace ontologenius {
 
   std::unordered_set<index_t> IndividualGraph::getDomainOf(index_t individual, int depth)
   {
-    IndividualBranch* branch = getIndividualByIndex(individual);
+    IndividualBranch* branch = findBranch(individual);
     std::unordered_set<index_t> res;
     getDomainOf(branch, res, depth);
     return res;
@@ -1095,7 +1098,7 @@ namespace ontologenius {
 
   std::unordered_set<index_t> IndividualGraph::getRangeOf(index_t individual, int depth)
   {
-    IndividualBranch* branch = getIndividualByIndex(individual);
+    IndividualBranch* branch = findBranch(individual);
     std::unordered_set<index_t> res;
     getRangeOf(branch, res, depth);
     return res;
@@ -1113,7 +1116,7 @@ namespace ontologenius {
 
   std::unordered_set<std::string> IndividualGraph::getUp(const std::string& individual, int depth)
   {
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
     IndividualBranch* indiv = container_.find(individual);
     std::unordered_set<std::string> res;
     getUp(indiv, res, depth);
@@ -1122,8 +1125,8 @@ namespace ontologenius {
 
   std::unordered_set<index_t> IndividualGraph::getUp(index_t individual, int depth)
   {
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
-    IndividualBranch* indiv = getIndividualByIndex(individual);
+    const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
+    IndividualBranch* indiv = findBranch(individual);
     std::unordered_set<index_t> res;
     getUp(indiv, res, depth);
     return res;
@@ -1187,7 +1190,6 @@ namespace ontologenius {
 
   void IndividualGraph::getDistincts(IndividualBranch* individual, std::unordered_set<IndividualBranch*>& res)
   {
-    const std::lock_guard<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
     if(individual != nullptr)
     {
       for(auto& distinct : individual->distinct_)
@@ -1202,7 +1204,7 @@ namespace ontologenius {
 
   std::unordered_set<index_t> IndividualGraph::getSameId(index_t individual)
   {
-    return getSameId(getIndividualByIndex(individual));
+    return getSameId(findBranch(individual));
   }
 
   void IndividualGraph::getLowestSame(IndividualBranch* individual, std::unordered_set<IndividualBranch*>& res)
@@ -1306,6 +1308,12 @@ namespace ontologenius {
     }
   }
 
+  void IndividualGraph::updateRelationIndexesUnsafe()
+  {
+    object_relations_index_.update();
+    data_relations_index_.update();
+  }
+
   std::unordered_set<std::string> IndividualGraph::select(const std::unordered_set<std::string>& on, const std::string& class_selector)
   {
     std::unordered_set<std::string> res;
@@ -1344,7 +1352,7 @@ namespace ontologenius {
     {
       if(it > 0)
       {
-        IndividualBranch* branch = getIndividualByIndex(it);
+        IndividualBranch* branch = findBranch(it);
         if(branch != nullptr)
         {
           std::unordered_set<index_t> tmp;
@@ -1388,7 +1396,7 @@ namespace ontologenius {
     const std::shared_lock<std::shared_timed_mutex> lock_class(class_graph_->mutex_);
 
     std::unordered_set<index_t> res;
-    ClassBranch* class_branch = class_graph_->container_.find(ValuedNode::table.get(class_selector));
+    ClassBranch* class_branch = class_graph_->findBranch(class_selector);
     if(class_branch != nullptr)
     {
       std::unordered_set<ClassBranch*> down_set;
@@ -1412,7 +1420,7 @@ namespace ontologenius {
   {
     const std::shared_lock<std::shared_timed_mutex> lock(Graph<IndividualBranch>::mutex_);
     const std::shared_lock<std::shared_timed_mutex> lock_class(class_graph_->mutex_);
-    IndividualBranch* branch = getIndividualByIndex(indiv);
+    IndividualBranch* branch = findBranch(indiv);
     return isA(branch, class_selector);
   }
 
@@ -1544,7 +1552,7 @@ namespace ontologenius {
   std::vector<std::string> IndividualGraph::getInferenceExplanation(const std::string& param)
   {
     std::vector<std::string> res;
-    std::function<std::vector<std::string>(const ProbabilisticElement& elem)> lambda = [](const ProbabilisticElement& elem) { return elem.explanation; };
+    std::function<std::vector<std::string>(const ProbabilisticElement& elem)> lambda = [](const ProbabilisticElement& elem) { return elem.explanation.getFacts(); };
     getInferenceData(param, res, lambda);
     return res;
   }
@@ -1552,7 +1560,7 @@ namespace ontologenius {
   std::vector<std::string> IndividualGraph::getInferenceExplanationIndex(const std::string& param)
   {
     std::vector<std::string> res;
-    std::function<std::vector<std::string>(const ProbabilisticElement& elem)> lambda = [](const ProbabilisticElement& elem) { return elem.explanation; };
+    std::function<std::vector<std::string>(const ProbabilisticElement& elem)> lambda = [](const ProbabilisticElement& elem) { return elem.explanation.getFacts(); };
     getInferenceDataIndex(param, res, lambda);
     return res;
   }
@@ -1604,7 +1612,7 @@ namespace ontologenius {
         return;
       }
 
-      auto* subject = getIndividualByIndex(index_token.front());
+      auto* subject = findBranch(index_token.front());
       if(subject != nullptr)
       {
         if(index_token.size() == 2)
@@ -1767,17 +1775,22 @@ namespace ontologenius {
   {
     if(indiv != nullptr)
     {
-      auto* class_branch = new ClassBranch(indiv->value());
-      class_branch->mothers_.relations = std::move(indiv->is_a_.relations);
+      auto* class_branch = class_graph_->createBranch(indiv->value());
+      // pushed one by one for each mother to get its inductions
+      for(auto& is_a : indiv->is_a_)
+        class_branch->mothers_.emplaceBack(is_a);
       class_branch->data_relations_.clear();
       for(auto& data_relation : indiv->data_relations_)
+      {
         class_branch->data_relations_.emplace_back(data_relation.first, data_relation.second, data_relation.probability);
+        class_graph_->data_relations_index_.add(data_relation.first->get(), class_branch, data_relation.second);
+      }
       class_branch->dictionary_ = std::move(indiv->dictionary_);
       class_branch->steady_dictionary_ = std::move(indiv->steady_dictionary_);
 
       class_graph_->container_.insert(class_branch);
-      class_graph_->all_branchs_.push_back(class_branch);
-      redirectDeleteIndividual(indiv, class_branch);
+      class_graph_->insertBranchInVectors(class_branch);
+      redirectDeleteIndividualUnsafe(indiv, class_branch);
 
       return class_branch;
     }
@@ -1790,24 +1803,17 @@ namespace ontologenius {
     return findOrCreateBranch(name);
   }
 
-  IndividualBranch* IndividualGraph::findOrCreateBranch(const std::string& name)
+  void IndividualGraph::deleteIndividual(IndividualBranch* indiv)
   {
-    IndividualBranch* indiv = Graph::findOrCreateBranch(name);
-    if(indiv != nullptr)
-    {
-      if((size_t)indiv->get() >= ordered_individuals_.size())
-        ordered_individuals_.resize(indiv->get() + 1, nullptr);
-      ordered_individuals_[indiv->get()] = indiv;
-    }
-    return indiv;
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock_class(class_graph_->mutex_);
+    deleteIndividualUnsafe(indiv);
   }
 
-  void IndividualGraph::deleteIndividual(IndividualBranch* indiv)
+  void IndividualGraph::deleteIndividualUnsafe(IndividualBranch* indiv)
   {
     if(indiv != nullptr)
     {
-      const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
-
       // erase indiv from same_as
       for(auto& same : indiv->same_as_)
         if(same.elem != indiv)
@@ -1815,7 +1821,6 @@ namespace ontologenius {
       indiv->same_as_.clear();
 
       // erase indiv from parents
-      const std::lock_guard<std::shared_timed_mutex> lock_class(class_graph_->mutex_);
       std::unordered_set<ClassBranch*> up_set;
       getUpPtr(indiv, up_set, 1);
 
@@ -1831,33 +1836,27 @@ namespace ontologenius {
       }
 
       // erase relations applied toward indiv
-      size_t indiv_index = 0;
-      for(size_t indiv_i = 0; indiv_i < all_branchs_.size(); indiv_i++)
-      {
-        if(all_branchs_[indiv_i] == indiv)
-          indiv_index = indiv_i;
-
-        for(size_t i = 0; i < all_branchs_[indiv_i]->object_relations_.size();)
-          if(all_branchs_[indiv_i]->object_relations_[i].second == indiv)
-            all_branchs_[indiv_i]->object_relations_.erase(i);
-          else
-            i++;
-      }
+      eraseRelationsOn(indiv);
 
       // delete indiv
+      const size_t indiv_index = std::find(all_branchs_.begin(), all_branchs_.end(), indiv) - all_branchs_.begin();
       removeBranchInVectors(indiv_index);
       container_.erase(indiv);
-      delete indiv;
+      pool_.destroy(indiv);
     }
   }
 
   void IndividualGraph::redirectDeleteIndividual(IndividualBranch* indiv, ClassBranch* class_branch)
+  {
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock_class(class_graph_->mutex_);
+    redirectDeleteIndividualUnsafe(indiv, class_branch);
+  }
+
+  void IndividualGraph::redirectDeleteIndividualUnsafe(IndividualBranch* indiv, ClassBranch* class_branch)
   {
     if(indiv != nullptr)
     {
-      const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
-      const std::lock_guard<std::shared_timed_mutex> lock_class(class_graph_->mutex_);
-
       // erase indiv from parents
       std::unordered_set<ClassBranch*> up_set;
       class_graph_->getUpPtr(class_branch, up_set, 1);
@@ -1875,32 +1874,72 @@ namespace ontologenius {
             i++;
         }
       }
+      class_graph_->invalidateClosure();
 
       // erase properties applied to indiv
-      size_t indiv_index = 0;
-      for(size_t indiv_i = 0; indiv_i < all_branchs_.size(); indiv_i++)
-      {
-        if(all_branchs_[indiv_i] == indiv)
-          indiv_index = indiv_i;
-
-        for(size_t i = 0; i < all_branchs_[indiv_i]->object_relations_.size();)
-          if(all_branchs_[indiv_i]->object_relations_[i].second == indiv)
-            all_branchs_[indiv_i]->object_relations_.erase(i);
-          else
-            i++;
-      }
+      eraseRelationsOn(indiv);
 
       // delete indiv
+      const size_t indiv_index = std::find(all_branchs_.begin(), all_branchs_.end(), indiv) - all_branchs_.begin();
       removeBranchInVectors(indiv_index);
       container_.erase(indiv);
-      delete indiv;
+      pool_.destroy(indiv);
     }
   }
 
+  void IndividualGraph::eraseRelationsOn(IndividualBranch* indiv)
+  {
+    for(auto& relation : indiv->object_relations_)
+    {
+      object_relations_index_.remove(relation.first->get(), indiv, relation.second);
+      if(relation.second != indiv)
+        relation.second->removeIncomingRelation(relation.first, indiv);
+    }
+
+    for(auto& relation : indiv->data_relations_)
+      data_relations_index_.remove(relation.first->get(), indiv, relation.second);
+
+    std::unordered_set<IndividualBranch*> subjects;
+    for(auto& incoming : indiv->incoming_object_relations_)
+      subjects.insert(incoming.second);
+    indiv->incoming_object_relations_.clear();
+
+    subjects.erase(indiv);
+    for(auto* subject : subjects)
+      for(size_t i = 0; i < subject->object_relations_.size();)
+        if(subject->object_relations_[i].second == indiv)
+        {
+          object_relations_index_.remove(subject->object_relations_[i].first->get(), subject, indiv);
+          subject->object_relations_.erase(i);
+        }
+        else
+          i++;
+  }
+
+  void IndividualGraph::indexObjectRelation(IndividualBranch* indiv_from, ObjectPropertyBranch* property, IndividualBranch* indiv_on)
+  {
+    indiv_on->addIncomingRelation(property, indiv_from);
+    object_relations_index_.add(property->get(), indiv_from, indiv_on);
+  }
+
+  void IndividualGraph::eraseObjectRelation(IndividualBranch* branch, size_t relation_index)
+  {
+    auto& relation = branch->object_relations_[relation_index];
+    relation.second->removeIncomingRelation(relation.first, branch);
+    object_relations_index_.remove(relation.first->get(), branch, relation.second);
+    branch->object_relations_.erase(relation_index);
+  }
+
   bool IndividualGraph::addInheritage(const std::string& indiv, const std::string& class_inherited)
   {
-    IndividualBranch* branch = findBranchSafe(indiv);
-    return addInheritage(branch, class_inherited);
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock_class(class_graph_->mutex_);
+    return addInheritageUnsafe(indiv, class_inherited);
+  }
+
+  bool IndividualGraph::addInheritageUnsafe(const std::string& indiv, const std::string& class_inherited)
+  {
+    return addInheritageUnsafe(findBranch(indiv), class_inherited);
   }
 
   bool IndividualGraph::addInheritage(IndividualBranch* branch, const std::string& class_inherited)
@@ -1922,15 +1961,15 @@ namespace ontologenius {
           inherited = upgradeToBranch(tmp);
         else
         {
-          inherited = new ClassBranch(class_inherited);
+          inherited = class_graph_->createBranch(class_inherited);
           class_graph_->container_.insert(inherited);
-          class_graph_->all_branchs_.push_back(inherited);
+          class_graph_->insertBranchInVectors(inherited);
         }
       }
       conditionalPushBack(branch->is_a_, ClassElement(inherited));
       conditionalPushBack(inherited->individual_childs_, IndividualElement(branch));
-      branch->updated_ = true;
-      inherited->updated_ = true;
+      setUpdated(branch);
+      class_graph_->setUpdated(inherited);
 
       return true; // TODO verify that multi inheritances are compatible
     }
@@ -1940,17 +1979,21 @@ namespace ontologenius {
 
   bool IndividualGraph::addInheritageInvert(const std::string& indiv, const std::string& class_inherited)
   {
-    ClassBranch* inherited = class_graph_->findBranchSafe(class_inherited);
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock_class(class_graph_->mutex_);
+    return addInheritageInvertUnsafe(indiv, class_inherited);
+  }
+
+  bool IndividualGraph::addInheritageInvertUnsafe(const std::string& indiv, const std::string& class_inherited)
+  {
+    ClassBranch* inherited = class_graph_->findBranch(class_inherited);
     if(inherited != nullptr)
     {
-      IndividualBranch* branch = findOrCreateBranchSafe(indiv);
-      const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
-      const std::lock_guard<std::shared_timed_mutex> lock_class(class_graph_->mutex_);
-
+      IndividualBranch* branch = findOrCreateBranch(indiv);
       conditionalPushBack(branch->is_a_, ClassElement(inherited));
       conditionalPushBack(inherited->individual_childs_, IndividualElement(branch));
-      branch->updated_ = true;
-      inherited->updated_ = true;
+      setUpdated(branch);
+      class_graph_->setUpdated(inherited);
 
       return true; // TODO verify that multi inheritances are compatible
     }
@@ -1960,18 +2003,23 @@ namespace ontologenius {
 
   bool IndividualGraph::addInheritageInvertUpgrade(const std::string& indiv, const std::string& class_inherited)
   {
-    IndividualBranch* tmp = findBranchSafe(class_inherited);
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock_class(class_graph_->mutex_);
+    return addInheritageInvertUpgradeUnsafe(indiv, class_inherited);
+  }
+
+  bool IndividualGraph::addInheritageInvertUpgradeUnsafe(const std::string& indiv, const std::string& class_inherited)
+  {
+    IndividualBranch* tmp = findBranch(class_inherited);
     if(tmp != nullptr)
     {
+      IndividualBranch* branch = findOrCreateBranch(indiv);
       ClassBranch* inherited = upgradeToBranch(tmp);
-      IndividualBranch* branch = findOrCreateBranchSafe(indiv);
-      const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
-      const std::lock_guard<std::shared_timed_mutex> lock_class(class_graph_->mutex_);
 
       conditionalPushBack(branch->is_a_, ClassElement(inherited));
       conditionalPushBack(inherited->individual_childs_, IndividualElement(branch));
-      branch->updated_ = true;
-      inherited->updated_ = true;
+      setUpdated(branch);
+      class_graph_->setUpdated(inherited);
 
       return true; // TODO verify that multi inheritances are compatible
     }
@@ -2003,9 +2051,10 @@ namespace ontologenius {
         throw GraphException("Inconsistency prevented regarding the range or domain of the property");
 
       indiv_from->object_relations_.emplaceBack(property, indiv_on);
+      indexObjectRelation(indiv_from, property, indiv_on);
       index = (int)indiv_from->object_relations_.size() - 1;
-      indiv_on->updated_ = true;
-      indiv_from->updated_ = true;
+      setUpdated(indiv_on);
+      setUpdated(indiv_from);
     }
 
     indiv_from->object_relations_[index].probability = (float)proba;
@@ -2024,12 +2073,13 @@ namespace ontologenius {
       if(index == -1)
       {
         indiv_from->data_relations_.emplaceBack(property, data);
+        data_relations_index_.add(property->get(), indiv_from, data);
         index = (int)indiv_from->data_relations_.size() - 1;
       }
 
       indiv_from->data_relations_[index].probability = (float)proba;
       indiv_from->data_relations_[index].inferred = inferred;
-      indiv_from->updated_ = true;
+      setUpdated(indiv_from);
 
       return index;
     }
@@ -2039,61 +2089,77 @@ namespace ontologenius {
     return -1;
   }
 
-  void IndividualGraph::addRelation(IndividualBranch* indiv_from, const std::string& property, const std::string& indiv_on)
+  void IndividualGraph::addRelation(IndividualBranch* indiv_from, const std::string& property, const std::string& indiv_on, double proba)
+  {
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock_class(class_graph_->mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock_object(object_property_graph_->mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock_data(data_property_graph_->mutex_);
+    addRelationUnsafe(indiv_from, property, indiv_on, proba);
+  }
+
+  void IndividualGraph::addRelationUnsafe(IndividualBranch* indiv_from, const std::string& property, const std::string& indiv_on, double proba)
   {
     IndividualBranch* branch_from = indiv_from;
     if(branch_from != nullptr)
     {
-      IndividualBranch* branch_on = findBranchSafe(indiv_on);
+      IndividualBranch* branch_on = findBranch(indiv_on);
       if(branch_on == nullptr)
       {
-        ClassBranch* test = class_graph_->findBranchSafe(indiv_on);
+        ClassBranch* test = class_graph_->findBranch(indiv_on);
         if(test != nullptr)
           throw GraphException("object entity does not exists");
 
-        branch_on = findOrCreateBranchSafe(indiv_on);
+        branch_on = findOrCreateBranch(indiv_on);
       }
-      const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
 
-      ObjectPropertyBranch* branch_prop = object_property_graph_->findBranchSafe(property);
+      ObjectPropertyBranch* branch_prop = object_property_graph_->findBranch(property);
       if(branch_prop == nullptr)
       {
-        DataPropertyBranch* test = data_property_graph_->findBranchSafe(property);
+        DataPropertyBranch* test = data_property_graph_->findBranch(property);
         if(test != nullptr)
           throw GraphException(property + " is a data property");
 
-        const std::lock_guard<std::shared_timed_mutex> lock_property(object_property_graph_->mutex_);
         branch_prop = object_property_graph_->newDefaultBranch(property);
       }
 
-      addRelation(branch_from, branch_prop, branch_on);
+      addRelation(branch_from, branch_prop, branch_on, proba);
     }
     else
       throw GraphException("The individual to apply the relation does not exist");
   }
 
-  void IndividualGraph::addRelation(IndividualBranch* indiv_from, const std::string& property, const std::string& type, const std::string& data)
+  void IndividualGraph::addRelation(IndividualBranch* indiv_from, const std::string& property, const std::string& type, const std::string& data, double proba)
+  {
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock_class(class_graph_->mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock_object(object_property_graph_->mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock_data(data_property_graph_->mutex_);
+    addRelationUnsafe(indiv_from, property, type, data, proba);
+  }
+
+  void IndividualGraph::addRelationUnsafe(IndividualBranch* indiv_from, const std::string& property, const std::string& type, const std::string& data, double proba)
   {
     IndividualBranch* branch_from = indiv_from;
     if(branch_from != nullptr)
     {
-      LiteralNode* literal = data_property_graph_->createLiteral(type + "#" + data);
+      LiteralNode* literal = data_property_graph_->createLiteralUnsafe(type + "#" + data);
 
-      DataPropertyBranch* branch_prop = data_property_graph_->findBranchSafe(property);
+      DataPropertyBranch* branch_prop = data_property_graph_->findBranch(property);
       if(branch_prop == nullptr)
       {
-        ObjectPropertyBranch* test = object_property_graph_->findBranchSafe(property);
+        ObjectPropertyBranch* test = object_property_graph_->findBranch(property);
         if(test != nullptr)
           throw GraphException(property + " is an object property");
 
-        const std::lock_guard<std::shared_timed_mutex> lock_property(data_property_graph_->mutex_);
         branch_prop = data_property_graph_->newDefaultBranch(property);
       }
 
       if(checkRangeAndDomain(branch_from, branch_prop, literal))
       {
-        conditionalPushBack(branch_from->data_relations_, IndivDataRelationElement(branch_prop, literal));
-        branch_from->updated_ = true;
+        if(conditionalPushBack(branch_from->data_relations_, IndivDataRelationElement(branch_prop, literal, proba)))
+          data_relations_index_.add(branch_prop->get(), branch_from, literal);
+        setUpdated(branch_from);
       }
       else
         throw GraphException("Inconsistency prevented regarding the range or domain of the property");
@@ -2102,34 +2168,41 @@ namespace ontologenius {
       throw GraphException("The individual to apply the relation does not exist");
   }
 
-  void IndividualGraph::addRelationInvert(const std::string& indiv_from, const std::string& property, IndividualBranch* indiv_on)
+  void IndividualGraph::addRelationInvert(const std::string& indiv_from, const std::string& property, IndividualBranch* indiv_on, double proba)
+  {
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock_class(class_graph_->mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock_object(object_property_graph_->mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock_data(data_property_graph_->mutex_);
+    addRelationInvertUnsafe(indiv_from, property, indiv_on, proba);
+  }
+
+  void IndividualGraph::addRelationInvertUnsafe(const std::string& indiv_from, const std::string& property, IndividualBranch* indiv_on, double proba)
   {
     IndividualBranch* branch_on = indiv_on;
     if(branch_on != nullptr)
     {
-      IndividualBranch* branch_from = findBranchSafe(indiv_from);
+      IndividualBranch* branch_from = findBranch(indiv_from);
       if(branch_from == nullptr)
       {
-        ClassBranch* test = class_graph_->findBranchSafe(indiv_from);
+        ClassBranch* test = class_graph_->findBranch(indiv_from);
         if(test != nullptr)
           throw GraphException("The individual to apply the relation does not exist");
 
-        branch_from = findOrCreateBranchSafe(indiv_from);
+        branch_from = findOrCreateBranch(indiv_from);
       }
-      const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
 
-      ObjectPropertyBranch* branch_prop = object_property_graph_->findBranchSafe(property);
+      ObjectPropertyBranch* branch_prop = object_property_graph_->findBranch(property);
       if(branch_prop == nullptr)
       {
-        DataPropertyBranch* test = data_property_graph_->findBranchSafe(property);
+        DataPropertyBranch* test = data_property_graph_->findBranch(property);
         if(test != nullptr)
           throw GraphException(property + " is a data property");
 
-        const std::lock_guard<std::shared_timed_mutex> lock_property(object_property_graph_->mutex_);
         branch_prop = object_property_graph_->newDefaultBranch(property);
       }
 
-      addRelation(branch_from, branch_prop, branch_on);
+      addRelation(branch_from, branch_prop, branch_on, proba);
     }
     else
       throw GraphException("Object entity does not exists");
@@ -2137,8 +2210,15 @@ namespace ontologenius {
 
   std::vector<std::pair<std::string, std::string>> IndividualGraph::removeInheritage(const std::string& indiv, const std::string& class_inherited)
   {
-    IndividualBranch* branch_base = findBranchSafe(indiv);
-    ClassBranch* branch_inherited = class_graph_->findBranchSafe(class_inherited);
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    const std::lock_guard<std::shared_timed_mutex> lock_class(class_graph_->mutex_);
+    return removeInheritageUnsafe(indiv, class_inherited);
+  }
+
+  std::vector<std::pair<std::string, std::string>> IndividualGraph::removeInheritageUnsafe(const std::string& indiv, const std::string& class_inherited)
+  {
+    IndividualBranch* branch_base = findBranch(indiv);
+    ClassBranch* branch_inherited = class_graph_->findBranch(class_inherited);
     std::vector<std::pair<std::string, std::string>> explanations;
 
     if(branch_base == nullptr)
@@ -2150,9 +2230,6 @@ namespace ontologenius {
       throw GraphException("The class_inherited entity does not exist");
     }
 
-    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
-    const std::lock_guard<std::shared_timed_mutex> lock_class(class_graph_->mutex_);
-
     removeInheritage(branch_base, branch_inherited, explanations);
 
     return explanations;
@@ -2176,8 +2253,8 @@ namespace ontologenius {
         indiv->is_a_.erase(i);
 
         removeFromElemVect(class_branch->individual_childs_, indiv);
-        indiv->updated_ = true;
-        class_branch->updated_ = true;
+        setUpdated(indiv);
+        class_graph_->setUpdated(class_branch);
         return true;
       }
     }
@@ -2186,16 +2263,22 @@ namespace ontologenius {
 
   void IndividualGraph::addSameAs(const std::string& indiv_1, const std::string& indiv_2)
   {
-    IndividualBranch* branch_1 = findBranchSafe(indiv_1);
-    IndividualBranch* branch_2 = findBranchSafe(indiv_2);
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    addSameAsUnsafe(indiv_1, indiv_2);
+  }
+
+  void IndividualGraph::addSameAsUnsafe(const std::string& indiv_1, const std::string& indiv_2)
+  {
+    IndividualBranch* branch_1 = findBranch(indiv_1);
+    IndividualBranch* branch_2 = findBranch(indiv_2);
 
     if((branch_1 == nullptr) && (branch_2 == nullptr))
       throw GraphException("no known items in the request");
 
     if(branch_1 == nullptr)
-      branch_1 = findOrCreateBranchSafe(indiv_1);
+      branch_1 = findOrCreateBranch(indiv_1);
     else if(branch_2 == nullptr)
-      branch_2 = findOrCreateBranchSafe(indiv_2);
+      branch_2 = findOrCreateBranch(indiv_2);
     else
     {
       std::unordered_set<IndividualBranch*> distincts;
@@ -2203,7 +2286,6 @@ namespace ontologenius {
       if(distincts.find(branch_2) != distincts.end())
         throw GraphException(branch_1->value() + " and " + branch_2->value() + " are distinct");
     }
-    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
 
     conditionalPushBack(branch_1->same_as_, IndividualElement(branch_2));
     conditionalPushBack(branch_2->same_as_, IndividualElement(branch_1));
@@ -2214,15 +2296,20 @@ namespace ontologenius {
 
   std::vector<std::pair<std::string, std::string>> IndividualGraph::removeSameAs(const std::string& indiv_1, const std::string& indiv_2, bool protect_stated)
   {
-    IndividualBranch* branch_1 = findBranchSafe(indiv_1);
-    IndividualBranch* branch_2 = findBranchSafe(indiv_2);
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    return removeSameAsUnsafe(indiv_1, indiv_2, protect_stated);
+  }
+
+  std::vector<std::pair<std::string, std::string>> IndividualGraph::removeSameAsUnsafe(const std::string& indiv_1, const std::string& indiv_2, bool protect_stated)
+  {
+    IndividualBranch* branch_1 = findBranch(indiv_1);
+    IndividualBranch* branch_2 = findBranch(indiv_2);
 
     if((branch_1 == nullptr) || (branch_2 == nullptr))
     {
       throw GraphException("One of the two individuals used in sameAs relation does not exist");
     }
 
-    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
     std::vector<std::pair<std::string, std::string>> explanations;
 
     if(branch_1->same_as_.empty() == false)
@@ -2263,8 +2350,8 @@ namespace ontologenius {
     if(branch_2->same_as_.size() == 1)
       branch_2->same_as_.clear();
 
-    branch_1->updated_ = true;
-    branch_2->updated_ = true;
+    setUpdated(branch_1);
+    setUpdated(branch_2);
 
     return explanations;
   }
@@ -2303,9 +2390,9 @@ namespace ontologenius {
             explanations.insert(explanations.end(), exp_sym.begin(), exp_sym.end());
             explanations.insert(explanations.end(), exp_ch.begin(), exp_ch.end());
 
-            object_relation.second->updated_ = true;
-            branch_from->object_relations_.erase(i);
-            branch_from->updated_ = true;
+            setUpdated(object_relation.second);
+            eraseObjectRelation(branch_from, i);
+            setUpdated(branch_from);
             applied = true;
 
             if(branch_on == nullptr)
@@ -2325,15 +2412,22 @@ namespace ontologenius {
 
   std::vector<std::pair<std::string, std::string>> IndividualGraph::removeRelation(const std::string& indiv_from, const std::string& property, const std::string& indiv_on)
   {
-    IndividualBranch* branch_from = findBranchSafe(indiv_from);
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    const std::shared_lock<std::shared_timed_mutex> lock_object(object_property_graph_->mutex_);
+    return removeRelationUnsafe(indiv_from, property, indiv_on);
+  }
+
+  std::vector<std::pair<std::string, std::string>> IndividualGraph::removeRelationUnsafe(const std::string& indiv_from, const std::string& property, const std::string& indiv_on)
+  {
+    IndividualBranch* branch_from = findBranch(indiv_from);
     if(branch_from != nullptr)
     {
-      ObjectPropertyBranch* branch_property = object_property_graph_->findBranchSafe(property);
+      ObjectPropertyBranch* branch_property = object_property_graph_->findBranch(property);
       if(branch_property != nullptr)
       {
         if(indiv_on != "_")
         {
-          IndividualBranch* branch_on = findBranchSafe(indiv_on);
+          IndividualBranch* branch_on = findBranch(indiv_on);
           if(branch_on != nullptr)
             return removeRelation(branch_from, branch_property, branch_on).first;
           else
@@ -2352,9 +2446,15 @@ namespace ontologenius {
   }
 
   std::vector<std::pair<std::string, std::string>> IndividualGraph::removeRelation(const std::string& indiv_from, const std::string& property, const std::string& type, const std::string& data)
+  {
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    return removeRelationUnsafe(indiv_from, property, type, data);
+  }
+
+  std::vector<std::pair<std::string, std::string>> IndividualGraph::removeRelationUnsafe(const std::string& indiv_from, const std::string& property, const std::string& type, const std::string& data)
   {
     std::vector<std::pair<std::string, std::string>> explanations;
-    IndividualBranch* branch_from = findBranchSafe(indiv_from);
+    IndividualBranch* branch_from = findBranch(indiv_from);
     if(branch_from != nullptr)
     {
       const bool fuzzy = (type == "_") || (data == "_");
@@ -2368,8 +2468,9 @@ namespace ontologenius {
             auto tmp_expl = removeInductions(branch_from, branch_from->data_relations_, i);
             explanations.insert(explanations.end(), tmp_expl.begin(), tmp_expl.end());
 
+            data_relations_index_.remove(branch_from->data_relations_[i].first->get(), branch_from, branch_from->data_relations_[i].second);
             branch_from->data_relations_.erase(i);
-            branch_from->updated_ = true;
+            setUpdated(branch_from);
 
             if(fuzzy == false)
               return explanations;
@@ -2401,9 +2502,9 @@ namespace ontologenius {
           auto exp_ch = removeInductions(indiv_on, indiv_on->object_relations_, i);
           explanations.insert(explanations.end(), exp_ch.begin(), exp_ch.end());
 
-          indiv_on->object_relations_[i].second->updated_ = true;
-          indiv_on->object_relations_.erase(i);
-          indiv_on->updated_ = true;
+          setUpdated(indiv_on->object_relations_[i].second);
+          eraseObjectRelation(indiv_on, i);
+          setUpdated(indiv_on);
         }
         else
           i++;
@@ -2426,9 +2527,9 @@ namespace ontologenius {
           auto exp_ch = removeInductions(indiv_on, indiv_on->object_relations_, i);
           explanations.insert(explanations.end(), exp_ch.begin(), exp_ch.end());
 
-          indiv_on->object_relations_[i].second->updated_ = true;
-          indiv_on->object_relations_.erase(i);
-          indiv_on->updated_ = true;
+          setUpdated(indiv_on->object_relations_[i].second);
+          eraseObjectRelation(indiv_on, i);
+          setUpdated(indiv_on);
         }
     }
     return explanations;
@@ -2497,10 +2598,9 @@ namespace ontologenius {
     }
 
     // RANGE
-    std::unordered_set<std::string> range = data_property_graph_->getRange(prop->value());
-    if(range.empty() == false)
+    if(prop->ranges_.empty() == false)
     {
-      if(range.find(data->type_) == range.end())
+      if(std::none_of(prop->ranges_.begin(), prop->ranges_.end(), [data](LiteralNode* range) { return range->type_ == data->type_; }))
         return false;
     }
 
@@ -2522,13 +2622,9 @@ namespace ontologenius {
     new_branch->dictionary_ = old_branch->dictionary_;
     new_branch->steady_dictionary_ = old_branch->steady_dictionary_;
 
+    // the traces are moved on the copied triplets by the ontology once all the graphs are copied
     for(const auto& is_a : old_branch->is_a_)
-    {
-      if(is_a.inferred && (is_a.induced_traces.empty() == false))
-        new_branch->updated_ = true;
-      else
-        new_branch->is_a_.emplaceBack(is_a, class_graph_->container_.find(is_a.elem->value()));
-    }
+      new_branch->is_a_.emplaceBack(is_a, class_graph_->container_.find(is_a.elem->value()));
 
     for(const auto& same : old_branch->same_as_)
       new_branch->same_as_.emplaceBack(same, container_.find(same.elem->value()));
@@ -2538,38 +2634,19 @@ namespace ontologenius {
 
     for(const auto& relation : old_branch->object_relations_)
     {
-      // inferred relations using traces should not be copied but recomputed
-      if(relation.inferred && (relation.induced_traces.empty() == false))
-        new_branch->updated_ = true;
-      else
-      {
-        auto* prop = object_property_graph_->container_.find(relation.first->value());
-        auto* on = container_.find(relation.second->value());
-        new_branch->object_relations_.emplaceBack(relation, prop, on);
-      }
+      auto* prop = object_property_graph_->container_.find(relation.first->value());
+      auto* on = container_.find(relation.second->value());
+      new_branch->object_relations_.emplaceBack(relation, prop, on);
+      indexObjectRelation(new_branch, prop, on);
     }
 
     for(const auto& relation : old_branch->data_relations_)
     {
       auto* prop = data_property_graph_->container_.find(relation.first->value());
-      auto* data = relation.second;
+      auto* data = data_property_graph_->literal_container_.find(relation.second->value());
       new_branch->data_relations_.emplaceBack(relation, prop, data);
+      data_relations_index_.add(prop->get(), new_branch, data);
     }
   }
 
-  void IndividualGraph::insertBranchInVectors(IndividualBranch* branch)
-  {
-    all_branchs_.push_back(branch);
-    if((size_t)branch->get() >= ordered_individuals_.size())
-      ordered_individuals_.resize(branch->get() + 1, nullptr);
-    ordered_individuals_[branch->get()] = branch;
-  }
-
-  void IndividualGraph::removeBranchInVectors(size_t vector_index)
-  {
-    const index_t index = all_branchs_[vector_index]->get();
-    all_branchs_.erase(all_branchs_.begin() + (int)vector_index);
-    ordered_individuals_[index] = nullptr;
-  }
-
 } // namespace ontologenius
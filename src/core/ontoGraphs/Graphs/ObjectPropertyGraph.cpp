@@ -22,21 +22,24 @@
 namespace ontologenius {
 
   ObjectPropertyGraph::ObjectPropertyGraph(IndividualGraph* individual_graph,
-                                           ClassGraph* class_graph) : OntoGraph(individual_graph),
-                                                                      class_graph_(class_graph)
+                                           ClassGraph* class_graph,
+                                           WordTable* table) : OntoGraph(individual_graph, table),
+                                                               class_graph_(class_graph)
   {}
 
   ObjectPropertyGraph::ObjectPropertyGraph(const ObjectPropertyGraph& other,
                                            IndividualGraph* individual_graph,
-                                           ClassGraph* class_graph) : OntoGraph(individual_graph),
-                                                                      class_graph_(class_graph)
+                                           ClassGraph* class_graph,
+                                           WordTable* table) : OntoGraph(individual_graph, table),
+                                                               class_graph_(class_graph)
   {
     language_ = other.language_;
+    deterministic_names_ = other.deterministic_names_;
 
     for(const auto& branch : other.all_branchs_)
     {
-      auto* prop_branch = new ObjectPropertyBranch(branch->value());
-      all_branchs_.push_back(prop_branch);
+      auto* prop_branch = createBranch(branch->value());
+      insertBranchInVectors(prop_branch);
     }
 
     this->container_.load(all_branchs_);
@@ -58,6 +61,7 @@ namespace ontologenius {
       conditionalPushBack(mother_branch->childs_, ObjectPropertyElement(me, mother.probability, true));
       conditionalPushBack(me->mothers_, ObjectPropertyElement(mother_branch, mother.probability));
     }
+    invalidateClosure();
 
     /**********************
     ** Disjoints
@@ -112,6 +116,7 @@ namespace ontologenius {
     me->annotation_usage_ = me->annotation_usage_ || property_vectors.annotation_usage_;
     me->setSteadyDictionary(property_vectors.dictionary_);
     me->setSteadyMutedDictionary(property_vectors.muted_dictionary_);
+    labels_.update(me);
 
     /**********************
     ** Chain axiom
@@ -185,7 +190,7 @@ namespace ontologenius {
     std::unordered_set<index_t> res;
     const std::shared_lock<std::shared_timed_mutex> lock(Graph<ObjectPropertyBranch>::mutex_);
 
-    ObjectPropertyBranch* branch = container_.find(ValuedNode::table.get(value));
+    ObjectPropertyBranch* branch = findBranch(value);
     if(branch != nullptr)
       for(auto& inverse : branch->inverses_)
         getDown(inverse.elem, res);
@@ -211,7 +216,7 @@ namespace ontologenius {
     std::unordered_set<index_t> res;
     const std::shared_lock<std::shared_timed_mutex> lock(Graph<ObjectPropertyBranch>::mutex_);
 
-    ObjectPropertyBranch* branch = container_.find(ValuedNode::table.get(value));
+    ObjectPropertyBranch* branch = findBranch(value);
     std::unordered_set<ObjectPropertyBranch*> up_trace;
     if(branch != nullptr)
       getDomain(branch, depth, res, up_trace);
@@ -265,7 +270,7 @@ namespace ontologenius {
     std::unordered_set<index_t> res;
     const std::shared_lock<std::shared_timed_mutex> lock(Graph<ObjectPropertyBranch>::mutex_);
 
-    ObjectPropertyBranch* branch = container_.find(ValuedNode::table.get(value));
+    ObjectPropertyBranch* branch = findBranch(value);
     std::unordered_set<ObjectPropertyBranch*> up_trace;
     if(branch != nullptr)
       getRange(branch, depth, res, up_trace);
@@ -324,6 +329,11 @@ namespace ontologenius {
   bool ObjectPropertyGraph::addInverseOf(const std::string& from, const std::string& on)
   {
     const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    return addInverseOfUnsafe(from, on);
+  }
+
+  bool ObjectPropertyGraph::addInverseOfUnsafe(const std::string& from, const std::string& on)
+  {
     ObjectPropertyBranch* from_branch = container_.find(from);
     ObjectPropertyBranch* on_branch = container_.find(on);
     if((from_branch == nullptr) && (on_branch == nullptr))
@@ -342,6 +352,12 @@ namespace ontologenius {
   }
 
   bool ObjectPropertyGraph::removeInverseOf(const std::string& from, const std::string& on)
+  {
+    const std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    return removeInverseOfUnsafe(from, on);
+  }
+
+  bool ObjectPropertyGraph::removeInverseOfUnsafe(const std::string& from, const std::string& on)
   {
     ObjectPropertyBranch* from_branch = container_.find(from);
     if(from_branch == nullptr)
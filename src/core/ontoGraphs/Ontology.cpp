@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <string>
+#include <unordered_map>
 
 #include "ontologenius/core/ontoGraphs/Checkers/AnonymousClassChecker.h"
 #include "ontologenius/core/ontoGraphs/Checkers/ClassChecker.h"
@@ -13,11 +14,11 @@
 
 namespace ontologenius {
 
-  Ontology::Ontology(const std::string& language) : class_graph_(&individual_graph_, &object_property_graph_, &data_property_graph_),
-                                                    object_property_graph_(&individual_graph_, &class_graph_),
-                                                    data_property_graph_(&individual_graph_, &class_graph_),
-                                                    individual_graph_(&class_graph_, &object_property_graph_, &data_property_graph_),
-                                                    anonymous_graph_(&class_graph_, &object_property_graph_, &data_property_graph_, &individual_graph_),
+  Ontology::Ontology(const std::string& language) : class_graph_(&individual_graph_, &object_property_graph_, &data_property_graph_, &table_),
+                                                    object_property_graph_(&individual_graph_, &class_graph_, &table_),
+                                                    data_property_graph_(&individual_graph_, &class_graph_, &table_, &literal_table_),
+                                                    individual_graph_(&class_graph_, &object_property_graph_, &data_property_graph_, &table_),
+                                                    anonymous_graph_(&class_graph_, &object_property_graph_, &data_property_graph_, &individual_graph_, &table_),
                                                     loader_((Ontology&)*this),
                                                     writer_((Ontology&)*this),
                                                     is_preloaded_(false),
@@ -30,11 +31,13 @@ namespace ontologenius {
     writer_.setFileName("none");
   }
 
-  Ontology::Ontology(const Ontology& other) : class_graph_(other.class_graph_, &individual_graph_, &object_property_graph_, &data_property_graph_),
-                                              object_property_graph_(other.object_property_graph_, &individual_graph_, &class_graph_),
-                                              data_property_graph_(other.data_property_graph_, &individual_graph_, &class_graph_),
-                                              individual_graph_(other.individual_graph_, &class_graph_, &object_property_graph_, &data_property_graph_),
-                                              anonymous_graph_(other.anonymous_graph_, &class_graph_, &object_property_graph_, &data_property_graph_, &individual_graph_),
+  Ontology::Ontology(const Ontology& other) : table_(other.table_),
+                                              literal_table_(other.literal_table_),
+                                              class_graph_(other.class_graph_, &individual_graph_, &object_property_graph_, &data_property_graph_, &table_),
+                                              object_property_graph_(other.object_property_graph_, &individual_graph_, &class_graph_, &table_),
+                                              data_property_graph_(other.data_property_graph_, &individual_graph_, &class_graph_, &table_, &literal_table_),
+                                              individual_graph_(other.individual_graph_, &class_graph_, &object_property_graph_, &data_property_graph_, &table_),
+                                              anonymous_graph_(other.anonymous_graph_, &class_graph_, &object_property_graph_, &data_property_graph_, &individual_graph_, &table_),
                                               loader_((Ontology&)*this),
                                               writer_((Ontology&)*this),
                                               is_preloaded_(true),
@@ -44,6 +47,7 @@ namespace ontologenius {
     object_property_graph_.deepCopy(other.object_property_graph_);
     data_property_graph_.deepCopy(other.data_property_graph_);
     individual_graph_.deepCopy(other.individual_graph_);
+    copyInductions(other);
 
     writer_.setFileName("none");
   }
@@ -53,6 +57,56 @@ namespace ontologenius {
     save();
   }
 
+  // Gives the branch of the copy for a branch of the copied ontology
+  struct CopyConverter
+  {
+    Ontology* onto;
+
+    IndividualBranch* operator()(IndividualBranch* branch) const { return onto->individual_graph_.findBranch(branch->get()); }
+    ObjectPropertyBranch* operator()(ObjectPropertyBranch* branch) const { return onto->object_property_graph_.findBranch(branch->get()); }
+    ClassBranch* operator()(ClassBranch* branch) const { return onto->class_graph_.findBranch(branch->get()); }
+  };
+
+  // The inferred relations are linked to the triplets they have been induced by.
+  // The graphs copy the relations with the traces and the explanations of other. The traces are moved
+  // on the copied triplets once all the relations exist, as a trace can be on a relation of another graph.
+  void Ontology::copyInductions(const Ontology& other)
+  {
+    std::unordered_map<TripletsInterface*, TripletsInterface*> copies;
+    for(size_t i = 0; i < other.class_graph_.all_branchs_.size(); i++)
+      class_graph_.all_branchs_[i]->mothers_.mapInductions(other.class_graph_.all_branchs_[i]->mothers_, copies);
+    for(size_t i = 0; i < other.object_property_graph_.all_branchs_.size(); i++)
+      object_property_graph_.all_branchs_[i]->mothers_.mapInductions(other.object_property_graph_.all_branchs_[i]->mothers_, copies);
+    for(size_t i = 0; i < other.data_property_graph_.all_branchs_.size(); i++)
+      data_property_graph_.all_branchs_[i]->mothers_.mapInductions(other.data_property_graph_.all_branchs_[i]->mothers_, copies);
+    for(size_t i = 0; i < other.individual_graph_.all_branchs_.size(); i++)
+    {
+      auto* old_branch = other.individual_graph_.all_branchs_[i];
+      auto* new_branch = individual_graph_.all_branchs_[i];
+      new_branch->is_a_.mapInductions(old_branch->is_a_, copies);
+      new_branch->object_relations_.mapInductions(old_branch->object_relations_, copies);
+      new_branch->data_relations_.mapInductions(old_branch->data_relations_, copies);
+      new_branch->same_as_.mapInductions(old_branch->same_as_, copies);
+    }
+
+    const CopyConverter converter{this};
+    for(size_t i = 0; i < other.class_graph_.all_branchs_.size(); i++)
+      class_graph_.all_branchs_[i]->mothers_.copyInductions(other.class_graph_.all_branchs_[i]->mothers_, copies, converter, explanation_table_);
+    for(size_t i = 0; i < other.object_property_graph_.all_branchs_.size(); i++)
+      object_property_graph_.all_branchs_[i]->mothers_.copyInductions(other.object_property_graph_.all_branchs_[i]->mothers_, copies, converter, explanation_table_);
+    for(size_t i = 0; i < other.data_property_graph_.all_branchs_.size(); i++)
+      data_property_graph_.all_branchs_[i]->mothers_.copyInductions(other.data_property_graph_.all_branchs_[i]->mothers_, copies, converter, explanation_table_);
+    for(size_t i = 0; i < other.individual_graph_.all_branchs_.size(); i++)
+    {
+      auto* old_branch = other.individual_graph_.all_branchs_[i];
+      auto* new_branch = individual_graph_.all_branchs_[i];
+      new_branch->is_a_.copyInductions(old_branch->is_a_, copies, converter, explanation_table_);
+      new_branch->object_relations_.copyInductions(old_branch->object_relations_, copies, converter, explanation_table_);
+      new_branch->data_relations_.copyInductions(old_branch->data_relations_, copies, converter, explanation_table_);
+      new_branch->same_as_.copyInductions(old_branch->same_as_, copies, converter, explanation_table_);
+    }
+  }
+
   bool Ontology::close()
   {
     if(is_init_ == true)
@@ -71,6 +125,9 @@ namespace ontologenius {
     if(err == 0)
     {
       loader_.loadIndividuals();
+      // nothing runs concurrently yet, the graphs do not have to be locked
+      individual_graph_.updateRelationIndexesUnsafe();
+      class_graph_.updateRelationIndexesUnsafe();
 
       individual_checker = IndividualChecker(&individual_graph_);
       err += individual_checker.check();
@@ -169,6 +226,14 @@ namespace ontologenius {
     return class_graph_.getLanguage();
   }
 
+  void Ontology::setDeterministicNames(bool deterministic)
+  {
+    class_graph_.setDeterministicNames(deterministic);
+    object_property_graph_.setDeterministicNames(deterministic);
+    data_property_graph_.setDeterministicNames(deterministic);
+    individual_graph_.setDeterministicNames(deterministic);
+  }
+
   void Ontology::setDisplay(bool display)
   {
     loader_.setDisplay(display);
@@ -275,7 +275,7 @@ namespace ontologenius {
               if(value != nullptr)
               {
                 const LiteralNode data(toString(sub_elem, "rdf:datatype"), std::string(value));
-                OntologyReader::push(object_vector.data_relations_, PairElement<std::string, std::string>(property, data.value(), probability), "$", "^");
+                OntologyReader::push(object_vector.data_relations_, PairElement<std::string, std::string>(property, data.toString(), probability), "$", "^");
               }
             }
           }
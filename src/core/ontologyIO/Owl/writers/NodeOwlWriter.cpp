@@ -11,7 +11,7 @@ namespace ontologenius {
 
   void NodeOwlWriter::writeDictionary(ValuedNode* node) const
   {
-    for(auto& it : node->steady_dictionary_.spoken_)
+    for(auto& it : node->steady_dictionary_.spoken_.toMap())
     {
       for(size_t i = 0; i < it.second.size(); i++)
       {
@@ -27,7 +27,7 @@ namespace ontologenius {
 
   void NodeOwlWriter::writeMutedDictionary(ValuedNode* node) const
   {
-    for(auto& it : node->steady_dictionary_.muted_)
+    for(auto& it : node->steady_dictionary_.muted_.toMap())
     {
       for(size_t i = 0; i < it.second.size(); i++)
       {
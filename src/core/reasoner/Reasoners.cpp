@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <pluginlib/exceptions.hpp>
@@ -195,7 +196,7 @@ namespace ontologenius {
     }
   }
 
-  void Reasoners::runPreReasoners(QueryOrigin_e origin, const std::string& action, const std::string& param)
+  bool Reasoners::runPreReasoners(QueryOrigin_e origin, const std::string& action, const std::string& param)
   {
     size_t nb_updates = 0;
 
@@ -217,43 +218,96 @@ namespace ontologenius {
       }
     }
 
-    nb_updates = ReasonerInterface::getNbUpdates();
-    ReasonerInterface::resetNbUpdates();
+    for(auto& it : active_reasoners_)
+    {
+      if(it.second != nullptr)
+      {
+        nb_updates += it.second->getNbUpdates();
+        it.second->resetNbUpdates();
+      }
+    }
 
     if(nb_updates != 0)
     {
       computeUpdates();
 
       runPostReasoners();
+      return true;
     }
+    return false;
   }
 
   void Reasoners::runPostReasoners()
   {
     size_t nb_updates = 0;
+    int changes = change_all; // the kinds of the fed changes are unknown
 
+    // A reasoner is only run again if the previous pass changed its inputs
     do
     {
+      std::vector<ReasonerInterface*> reasoners;
       for(auto& it : active_reasoners_)
+        if((it.second != nullptr) && ((it.second->getPostReasoningInputs() & changes) != 0))
+          reasoners.push_back(it.second);
+
+      for(const auto& wave : getPostReasoningWaves(reasoners))
       {
-        if(it.second != nullptr)
-        {
-          it.second->postReason();
-          auto notif = it.second->getNotifications();
-          notifications_.insert(notifications_.end(), notif.begin(), notif.end());
-          auto explanations = it.second->getExplanations();
-          explanations_mutex_.lock();
-          explanations_.insert(explanations_.end(), explanations.begin(), explanations.end());
-          explanations_mutex_.unlock();
-        }
+        std::vector<std::function<void()>> tasks;
+        tasks.reserve(wave.size());
+        for(size_t index : wave)
+          tasks.emplace_back([reasoner = reasoners[index]]() { reasoner->postReason(); });
+        pool_.run(tasks);
+      }
+
+      // The outputs are merged in the order of the reasoners, whatever the order they ran in
+      int new_changes = change_none;
+      nb_updates = 0;
+      for(auto* reasoner : reasoners)
+      {
+        if(reasoner->getNbUpdates() != 0)
+          new_changes |= reasoner->getPostReasoningOutputs();
+        nb_updates += reasoner->getNbUpdates();
+        reasoner->resetNbUpdates();
+        auto notif = reasoner->getNotifications();
+        notifications_.insert(notifications_.end(), notif.begin(), notif.end());
+        auto explanations = reasoner->getExplanations();
+        explanations_mutex_.lock();
+        explanations_.insert(explanations_.end(), explanations.begin(), explanations.end());
+        explanations_mutex_.unlock();
       }
-      nb_updates = ReasonerInterface::getNbUpdates();
-      ReasonerInterface::resetNbUpdates();
 
       computeUpdates();
+      changes = new_changes;
     } while(nb_updates != 0);
   }
 
+  // Reasoners whose changes do not overlap are run in the same wave.
+  // The other ones keep their order, each one running in a wave after the ones it depends on.
+  std::vector<std::vector<size_t>> Reasoners::getPostReasoningWaves(const std::vector<ReasonerInterface*>& reasoners)
+  {
+    std::vector<std::vector<size_t>> waves;
+    std::vector<size_t> reasoners_wave(reasoners.size(), 0);
+    for(size_t i = 0; i < reasoners.size(); i++)
+    {
+      const int inputs = reasoners[i]->getPostReasoningInputs();
+      const int outputs = reasoners[i]->getPostReasoningOutputs();
+      size_t wave = 0;
+      for(size_t j = 0; j < i; j++)
+      {
+        const int prev_inputs = reasoners[j]->getPostReasoningInputs();
+        const int prev_outputs = reasoners[j]->getPostReasoningOutputs();
+        if(((outputs & (prev_inputs | prev_outputs)) != 0) || ((prev_outputs & inputs) != 0))
+          wave = std::max(wave, reasoners_wave[j] + 1);
+      }
+
+      reasoners_wave[i] = wave;
+      if(wave == waves.size())
+        waves.emplace_back();
+      waves[wave].push_back(i);
+    }
+    return waves;
+  }
+
   void Reasoners::runPeriodicReasoners()
   {
     bool has_run = false;
@@ -314,30 +368,16 @@ namespace ontologenius {
 
   void Reasoners::computeUpdates()
   {
-    computeGraphUpdates(&ontology_->individual_graph_);
-    computeGraphUpdates(&ontology_->class_graph_);
-    computeGraphUpdates(&ontology_->object_property_graph_);
-    computeGraphUpdates(&ontology_->data_property_graph_);
-  }
-
-  template<typename B>
-  void Reasoners::computeGraphUpdates(Graph<B>* graph)
-  {
-    const std::vector<B*> branches = graph->get();
-    for(auto& branch : branches)
-      if(branch->nb_updates_ == 0)
-        branch->updated_ = false;
-      else
-      {
-        branch->nb_updates_ = 0;
-        branch->updated_ = true;
-      }
+    ontology_->individual_graph_.computeUpdates();
+    ontology_->class_graph_.computeUpdates();
+    ontology_->object_property_graph_.computeUpdates();
+    ontology_->data_property_graph_.computeUpdates();
   }
 
   void Reasoners::computeIndividualsUpdatesPeriodic()
   {
-    const std::vector<IndividualBranch*> indivs = ontology_->individual_graph_.getSafe();
-    for(auto* indiv : indivs)
+    const std::lock_guard<std::shared_timed_mutex> lock(ontology_->individual_graph_.mutex_);
+    for(auto* indiv : ontology_->individual_graph_.getUpdated())
       if(indiv->nb_updates_ != 0)
       {
         indiv->nb_updates_ = 0;
@@ -351,7 +391,7 @@ namespace ontologenius {
     for(auto* indiv : indivs)
     {
       indiv->nb_updates_ = 0;
-      indiv->updated_ = true;
+      ontology_->individual_graph_.setUpdated(indiv);
     }
   }
 
@@ -35,7 +35,7 @@ namespace ontologenius {
     const std::shared_lock<std::shared_timed_mutex> lock_prop(ontology_->object_property_graph_.mutex_);
     std::vector<std::pair<std::string, InheritedRelationTriplets*>> used;
 
-    for(auto* indiv : ontology_->individual_graph_.get())
+    for(auto* indiv : getIndividualsToCheck("equiv", flagged_))
     {
       if((indiv->updated_ == true) || (indiv->flags_.find("equiv") != indiv->flags_.end()) || indiv->hasUpdatedObjectRelation() || indiv->hasUpdatedDataRelation())
       {
@@ -70,13 +70,14 @@ namespace ontologenius {
                 {
                   if(ontology_->individual_graph_.conditionalPushBack(anonymous->class_equiv_->individual_childs_, IndividualElement(indiv, 1.0, true)))
                   {
-                    indiv->nb_updates_++;
-                    anonymous->class_equiv_->nb_updates_++;
-                    indiv->is_a_.back().explanation.reserve(used.size());
+                    ontology_->individual_graph_.addUpdate(indiv);
+                    ontology_->class_graph_.addUpdate(anonymous->class_equiv_);
+                    std::vector<std::string> explanation;
+                    explanation.reserve(used.size());
 
                     for(auto& induced_vector : used)
                     {
-                      indiv->is_a_.back().explanation.push_back(induced_vector.first);
+                      explanation.push_back(induced_vector.first);
                       // check for nullptr because OneOf returns a (string, nullptr)
                       if(induced_vector.second != nullptr)
                       {
@@ -88,6 +89,8 @@ namespace ontologenius {
                       }
                     }
 
+                    indiv->is_a_.back().explanation = ontology_->explanation_table_.add(explanation);
+
                     nb_update++;
                     explanations_.emplace_back("[ADD]" + indiv->value() + "|isA|" + anonymous->class_equiv_->value(),
                                                "[ADD]" + indiv->is_a_.back().getExplanation());
@@ -102,16 +105,22 @@ namespace ontologenius {
           // Manages implicitly the NOT, MIN, MAX, EXACTLY cases
           if(tree_evaluation_result == false && anonymous->ano_elems_.empty() == false && ontology_->individual_graph_.isA(indiv, anonymous->class_equiv_->get()) == true)
           {
-            indiv->nb_updates_++;
-            anonymous->class_equiv_->nb_updates_++;
+            ontology_->individual_graph_.addUpdate(indiv);
+            ontology_->class_graph_.addUpdate(anonymous->class_equiv_);
             ontology_->individual_graph_.removeInheritage(indiv, anonymous->class_equiv_, explanations_, true);
           }
         }
 
         if(has_active_equiv)
+        {
           indiv->flags_["equiv"] = {};
+          flagged_.insert(indiv->get());
+        }
         else
+        {
           indiv->flags_.erase("equiv");
+          flagged_.erase(indiv->get());
+        }
       }
     }
   }
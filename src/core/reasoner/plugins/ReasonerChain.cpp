@@ -21,7 +21,7 @@ namespace ontologenius {
     const std::lock_guard<std::shared_timed_mutex> lock(ontology_->individual_graph_.mutex_);
     const std::lock_guard<std::shared_timed_mutex> lock_prop(ontology_->object_property_graph_.mutex_);
 
-    for(auto* indiv : ontology_->individual_graph_.get())
+    for(auto* indiv : getIndividualsToCheck("chain", flagged_))
       if((indiv->updated_ == true) || (indiv->flags_.find("chain") != indiv->flags_.end()) || indiv->hasUpdatedObjectRelation())
       {
         bool has_active_chain = false;
@@ -53,7 +53,7 @@ namespace ontologenius {
                     try
                     {
                       index = ontology_->individual_graph_.addRelation(indiv, chain.back(), used.first, 1.0, true, false);
-                      indiv->nb_updates_++;
+                      ontology_->individual_graph_.addUpdate(indiv);
                     }
                     catch(GraphException& e)
                     {
@@ -62,10 +62,11 @@ namespace ontologenius {
                     }
 
                     used.second.insert(used.second.end(), local_used.begin(), local_used.end());
-                    indiv->object_relations_[index].explanation.reserve(used.second.size());
+                    std::vector<std::string> explanation;
+                    explanation.reserve(used.second.size());
                     for(auto it = used.second.rbegin(); it != used.second.rend(); ++it)
                     {
-                      indiv->object_relations_[index].explanation.push_back(it->first);
+                      explanation.push_back(it->first);
 
                       if(it->second->exist(indiv, chain.back(), used.first) == false)
                       {
@@ -74,6 +75,8 @@ namespace ontologenius {
                       }
                     }
 
+                    indiv->object_relations_[index].explanation = ontology_->explanation_table_.add(explanation);
+
                     nb_update++;
                     explanations_.emplace_back("[ADD]" + indiv->value() + "|" + chain.back()->value() + "|" + used.first->value(),
                                                "[ADD]" + indiv->object_relations_[index].getExplanation());
@@ -86,9 +89,15 @@ namespace ontologenius {
 
         // To prevent the chain to be triggered only when the first relation is added
         if(has_active_chain)
+        {
           indiv->flags_["chain"] = {};
+          flagged_.insert(indiv->get());
+        }
         else
+        {
           indiv->flags_.erase("chain");
+          flagged_.erase(indiv->get());
+        }
       }
   }
 
@@ -151,17 +160,8 @@ namespace ontologenius {
 
   bool ReasonerChain::relationExists(IndividualBranch* indiv_on, ObjectPropertyBranch* chain_prop, IndividualBranch* chain_indiv)
   {
-    for(auto& relation : indiv_on->object_relations_)
-    {
-      if(relation.second->get() == chain_indiv->get())
-      {
-        std::unordered_set<ObjectPropertyBranch*> down_properties;
-        ontology_->object_property_graph_.getDownPtr(chain_prop, down_properties);
-        if(down_properties.find(relation.first) != down_properties.end())
-          return true;
-      }
-    }
-    return false;
+    // the index holds the relations of the sub-properties under their super-properties
+    return ontology_->individual_graph_.object_relations_index_.contains(chain_prop->get(), indiv_on, chain_indiv);
   }
 
   std::string ReasonerChain::getName()
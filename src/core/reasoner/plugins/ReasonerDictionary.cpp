@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cctype>
 #include <cstddef>
+#include <map>
 #include <mutex>
 #include <pluginlib/class_list_macros.hpp>
 #include <shared_mutex>
@@ -13,6 +14,8 @@
 #include "ontologenius/core/ontoGraphs/Branchs/ValuedNode.h"
 #include "ontologenius/core/reasoner/plugins/ReasonerInterface.h"
 
+#define DICTIONARY_CACHE_MAX_SIZE 100000
+
 namespace ontologenius {
 
   void ReasonerDictionary::setParameter(const std::string& name, const std::string& value)
@@ -23,165 +26,194 @@ namespace ontologenius {
 
   void ReasonerDictionary::postReason()
   {
+    // only the updated nodes can have lost their derived labels, except before the first run
+    const bool all_nodes = first_run_;
+    first_run_ = false;
+
     {
       const std::lock_guard<std::shared_timed_mutex> lock(ontology_->individual_graph_.mutex_);
-      const std::vector<IndividualBranch*> indivs = ontology_->individual_graph_.get();
+      const std::vector<IndividualBranch*> indivs = all_nodes ? ontology_->individual_graph_.get() : ontology_->individual_graph_.getUpdated();
       for(auto* elem : indivs)
-        updateDictionary(elem);
+        if(updateDictionary(elem))
+          ontology_->individual_graph_.labels_.update(elem);
     }
 
     {
-      const std::vector<ClassBranch*> classes = ontology_->class_graph_.getSafe();
       const std::lock_guard<std::shared_timed_mutex> lock(ontology_->class_graph_.mutex_);
+      const std::vector<ClassBranch*> classes = all_nodes ? ontology_->class_graph_.get() : ontology_->class_graph_.getUpdated();
       for(auto* elem : classes)
-        updateDictionary(elem);
+        if(updateDictionary(elem))
+          ontology_->class_graph_.labels_.update(elem);
     }
 
     {
-      const std::vector<DataPropertyBranch*> data_properties = ontology_->data_property_graph_.getSafe();
       const std::lock_guard<std::shared_timed_mutex> lock(ontology_->data_property_graph_.mutex_);
+      const std::vector<DataPropertyBranch*> data_properties = all_nodes ? ontology_->data_property_graph_.get() : ontology_->data_property_graph_.getUpdated();
       for(auto* elem : data_properties)
-        updateDictionary(elem);
+        if(updateDictionary(elem))
+          ontology_->data_property_graph_.labels_.update(elem);
     }
 
     {
-      const std::vector<ObjectPropertyBranch*> object_properties = ontology_->object_property_graph_.getSafe();
       const std::lock_guard<std::shared_timed_mutex> lock(ontology_->object_property_graph_.mutex_);
+      const std::vector<ObjectPropertyBranch*> object_properties = all_nodes ? ontology_->object_property_graph_.get() : ontology_->object_property_graph_.getUpdated();
       for(auto* elem : object_properties)
-        updateDictionary(elem);
+        if(updateDictionary(elem))
+          ontology_->object_property_graph_.labels_.update(elem);
     }
   }
 
-  void ReasonerDictionary::updateDictionary(ValuedNode* node)
+  bool ReasonerDictionary::updateDictionary(ValuedNode* node)
   {
-    if(node->flags_.find("dico") == node->flags_.end())
+    if(node->flags_.find("dico") != node->flags_.end())
+      return false;
+
+    // the whole dictionary is derived again from the labels given to the node
+    std::map<std::string, std::vector<std::string>> spoken = node->steady_dictionary_.spoken_.toMap();
+    std::map<std::string, std::vector<std::string>> muted = node->steady_dictionary_.muted_.toMap();
+    const std::map<std::string, std::vector<std::string>> steady_muted = muted;
+    if(use_id_ && spoken["en"].empty())
+      spoken["en"].push_back(node->value());
+
+    for(auto& lang : spoken)
     {
-      if(use_id_)
-        setId(node);
-      split(node);
-      createLowerCase(node);
-      replaceQuote(node);
-      node->flags_["dico"].emplace_back("true");
+      auto& lang_muted = muted[lang.first];
+      const size_t nb_words = lang.second.size();
+      for(size_t i = 0; i < nb_words; i++)
+      {
+        const Derived_t& derived = getDerived(lang.second[i], true);
+        for(const auto& word : derived.spoken_)
+          addIfAbsent(word, lang.second, lang_muted);
+        for(const auto& word : derived.muted_)
+          addIfAbsent(word, lang_muted, lang.second);
+      }
     }
+
+    for(const auto& lang : steady_muted)
+    {
+      auto& lang_spoken = spoken[lang.first];
+      auto& lang_muted = muted[lang.first];
+      for(const auto& steady_word : lang.second)
+      {
+        const Derived_t& derived = getDerived(steady_word, false);
+        for(const auto& word : derived.muted_)
+          addIfAbsent(word, lang_muted, lang_spoken);
+      }
+    }
+
+    node->dictionary_.spoken_ = spoken;
+    node->dictionary_.muted_ = muted;
+    node->flags_["dico"].emplace_back("true");
+    return true;
   }
 
-  void ReasonerDictionary::setId(ValuedNode* node)
+  const ReasonerDictionary::Derived_t& ReasonerDictionary::getDerived(const std::string& word, bool spoken)
   {
-    if(node->dictionary_.spoken_["en"].empty())
-      node->dictionary_.spoken_["en"] = std::vector<std::string>(1, node->value());
+    auto& cache = spoken ? spoken_cache_ : muted_cache_;
+    auto it = cache.find(word);
+    if(it != cache.end())
+      return it->second;
+
+    if(cache.size() >= DICTIONARY_CACHE_MAX_SIZE)
+      cache.clear();
+
+    std::vector<std::string> spoken_words;
+    std::vector<std::string> muted_words;
+    (spoken ? spoken_words : muted_words).push_back(word);
+    split(spoken_words, muted_words);
+    createLowerCase(spoken_words, muted_words);
+    replaceQuote(spoken_words, muted_words);
+
+    // the word itself stays the first one
+    Derived_t derived;
+    derived.spoken_.assign(spoken_words.begin() + (spoken ? 1 : 0), spoken_words.end());
+    derived.muted_.assign(muted_words.begin() + (spoken ? 0 : 1), muted_words.end());
+    return cache.emplace(word, std::move(derived)).first->second;
   }
 
-  void ReasonerDictionary::split(ValuedNode* node)
+  void ReasonerDictionary::split(std::vector<std::string>& spoken, std::vector<std::string>& muted)
   {
-    for(auto& it : node->dictionary_.spoken_)
+    const size_t nb_spoken = spoken.size();
+    for(size_t i = 0; i < nb_spoken; i++)
     {
-      std::vector<std::string>* muted = &node->dictionary_.muted_[it.first];
+      std::string tmp = spoken[i];
+      std::replace(tmp.begin(), tmp.end(), '_', ' ');
+      addIfAbsent(tmp, spoken, muted);
 
-      for(auto& word : it.second)
-      {
-        std::string tmp = word;
-        std::replace(tmp.begin(), tmp.end(), '_', ' ');
-        if(std::find(it.second.begin(), it.second.end(), tmp) == it.second.end())
-          if(std::find(muted->begin(), muted->end(), tmp) == muted->end())
-            it.second.push_back(tmp);
-
-        std::replace(tmp.begin(), tmp.end(), '-', ' ');
-        if(std::find(it.second.begin(), it.second.end(), tmp) == it.second.end())
-          if(std::find(muted->begin(), muted->end(), tmp) == muted->end())
-            muted->push_back(tmp);
-      }
+      std::replace(tmp.begin(), tmp.end(), '-', ' ');
+      addIfAbsent(tmp, muted, spoken);
+    }
 
-      for(auto& word : it.second)
+    for(size_t i = 0; i < spoken.size(); i++)
+    {
+      const std::string word = spoken[i];
+      if(word.empty())
+        continue;
+
+      std::string tmp;
+      tmp += word[0];
+      for(size_t char_i = 1; char_i < word.size(); char_i++)
       {
-        std::string tmp;
-        tmp += word[0];
-        for(size_t char_i = 1; char_i < word.size(); char_i++)
-        {
-          if((word[char_i] >= 'A') && (word[char_i] <= 'Z'))
-            if(word[char_i - 1] != ' ')
-              tmp += ' ';
-          tmp += word[char_i];
-        }
-        if(std::find(it.second.begin(), it.second.end(), tmp) == it.second.end())
-          if(std::find(muted->begin(), muted->end(), tmp) == muted->end())
-            muted->push_back(tmp);
+        if((word[char_i] >= 'A') && (word[char_i] <= 'Z'))
+          if(word[char_i - 1] != ' ')
+            tmp += ' ';
+        tmp += word[char_i];
       }
+      addIfAbsent(tmp, muted, spoken);
     }
   }
 
-  void ReasonerDictionary::createLowerCase(ValuedNode* node)
+  void ReasonerDictionary::createLowerCase(std::vector<std::string>& spoken, std::vector<std::string>& muted)
   {
-    for(auto& it : node->dictionary_.muted_)
+    const size_t nb_muted = muted.size();
+    for(size_t i = 0; i < nb_muted; i++)
     {
-      for(auto& word : it.second)
-      {
-        if(word.empty() == false)
-        {
-          std::string tmp;
-          tmp.resize(word.size());
-          std::transform(word.begin(), word.end(), tmp.begin(), ::tolower);
-          if(std::find(it.second.begin(), it.second.end(), tmp) == it.second.end())
-            it.second.push_back(tmp);
-        }
-      }
+      std::string tmp = muted[i];
+      std::transform(tmp.begin(), tmp.end(), tmp.begin(), ::tolower);
+      addIfAbsent(tmp, muted, spoken);
     }
 
-    for(auto& it : node->dictionary_.spoken_)
+    for(const auto& word : spoken)
     {
-      std::vector<std::string>* muted = &node->dictionary_.muted_[it.first];
-      for(auto& word : it.second)
-      {
-        std::string tmp;
-        tmp.resize(word.size());
-        std::transform(word.begin(), word.end(), tmp.begin(), ::tolower);
-        if(std::find(it.second.begin(), it.second.end(), tmp) == it.second.end())
-          if(std::find(muted->begin(), muted->end(), tmp) == muted->end())
-            muted->push_back(tmp);
-      }
+      std::string tmp = word;
+      std::transform(tmp.begin(), tmp.end(), tmp.begin(), ::tolower);
+      addIfAbsent(tmp, muted, spoken);
     }
   }
 
-  void ReasonerDictionary::replaceQuote(ValuedNode* node)
+  void ReasonerDictionary::replaceQuote(std::vector<std::string>& spoken, std::vector<std::string>& muted)
   {
-    for(auto& it : node->dictionary_.spoken_)
+    for(const auto& word : spoken)
     {
-      std::vector<std::string>* muted = &node->dictionary_.muted_[it.first];
-      for(auto& word : it.second)
-      {
-        std::string tmp = word;
-        tmp.erase(std::remove(tmp.begin(), tmp.end(), '\''), tmp.end());
-        if(std::find(it.second.begin(), it.second.end(), tmp) == it.second.end())
-          if(std::find(muted->begin(), muted->end(), tmp) == muted->end())
-            muted->push_back(tmp);
-
-        tmp = word;
-        std::replace(tmp.begin(), tmp.end(), '\'', ' ');
-        if(std::find(it.second.begin(), it.second.end(), tmp) == it.second.end())
-          if(std::find(muted->begin(), muted->end(), tmp) == muted->end())
-            muted->push_back(tmp);
-      }
+      std::string tmp = word;
+      tmp.erase(std::remove(tmp.begin(), tmp.end(), '\''), tmp.end());
+      addIfAbsent(tmp, muted, spoken);
+
+      tmp = word;
+      std::replace(tmp.begin(), tmp.end(), '\'', ' ');
+      addIfAbsent(tmp, muted, spoken);
     }
 
-    for(auto& it : node->dictionary_.muted_)
+    const size_t nb_muted = muted.size();
+    for(size_t i = 0; i < nb_muted; i++)
     {
-      std::vector<std::string>* muted = &node->dictionary_.muted_[it.first];
-      for(auto& word : it.second)
-      {
-        std::string tmp = word;
-        tmp.erase(std::remove(tmp.begin(), tmp.end(), '\''), tmp.end());
-        if(std::find(it.second.begin(), it.second.end(), tmp) == it.second.end())
-          if(std::find(muted->begin(), muted->end(), tmp) == muted->end())
-            muted->push_back(tmp);
-
-        tmp = word;
-        std::replace(tmp.begin(), tmp.end(), '\'', ' ');
-        if(std::find(it.second.begin(), it.second.end(), tmp) == it.second.end())
-          if(std::find(muted->begin(), muted->end(), tmp) == muted->end())
-            muted->push_back(tmp);
-      }
+      std::string tmp = muted[i];
+      tmp.erase(std::remove(tmp.begin(), tmp.end(), '\''), tmp.end());
+      addIfAbsent(tmp, muted, spoken);
+
+      tmp = muted[i];
+      std::replace(tmp.begin(), tmp.end(), '\'', ' ');
+      addIfAbsent(tmp, muted, spoken);
     }
   }
 
+  void ReasonerDictionary::addIfAbsent(const std::string& word, std::vector<std::string>& words, const std::vector<std::string>& others)
+  {
+    if(std::find(words.begin(), words.end(), word) == words.end())
+      if(std::find(others.begin(), others.end(), word) == others.end())
+        words.push_back(word);
+  }
+
   std::string ReasonerDictionary::getName()
   {
     return "reasoner dictionary";
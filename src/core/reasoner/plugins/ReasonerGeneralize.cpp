@@ -109,7 +109,11 @@ namespace ontologenius {
           if(me->data_relations_[prop_i].probability < 1.0)
           {
             if(me->data_relations_[prop_i].second != std::get<1>(property))
+            {
               notifications_.emplace_back(notification_info, "[CHANGE]" + me->value() + ">" + std::get<0>(property)->value() + ":" + std::get<1>(property)->value());
+              ontology_->class_graph_.data_relations_index_.remove(std::get<0>(property)->get(), me, me->data_relations_[prop_i].second);
+              ontology_->class_graph_.data_relations_index_.add(std::get<0>(property)->get(), me, std::get<1>(property));
+            }
 
             me->data_relations_[prop_i].second = std::get<1>(property);
             me->data_relations_[prop_i].probability = (float)std::get<2>(property) - 0.01f;
@@ -120,6 +124,7 @@ namespace ontologenius {
       {
         notifications_.emplace_back(notification_info, "[NEW]" + me->value() + ">" + std::get<0>(property)->value() + ":" + std::get<1>(property)->value());
         me->data_relations_.emplace_back(std::get<0>(property), std::get<1>(property), (float)std::get<2>(property) - 0.01);
+        ontology_->class_graph_.data_relations_index_.add(std::get<0>(property)->get(), me, std::get<1>(property));
         std::get<0>(property)->annotation_usage_ = true;
       }
     }
@@ -130,6 +135,7 @@ namespace ontologenius {
       for(auto i : deduced_indexs)
       {
         notifications_.emplace_back(notification_info, "[DELETE]" + me->value() + ">" + me->data_relations_[i - deleted].first->value() + ":" + me->data_relations_[i - deleted].second->value());
+        ontology_->class_graph_.data_relations_index_.remove(me->data_relations_[i - deleted].first->get(), me, me->data_relations_[i - deleted].second);
         me->data_relations_.erase(me->data_relations_.begin() + (int)i - (int)deleted);
         deleted++;
       }
@@ -155,7 +161,11 @@ namespace ontologenius {
           if(me->object_relations_[prop_i].probability < 1.0)
           {
             if(me->object_relations_[prop_i].second != std::get<1>(property))
+            {
               notifications_.emplace_back(notification_info, "[CHANGE]" + me->value() + ">" + std::get<0>(property)->value() + ":" + std::get<1>(property)->value());
+              ontology_->class_graph_.object_relations_index_.remove(std::get<0>(property)->get(), me, me->object_relations_[prop_i].second);
+              ontology_->class_graph_.object_relations_index_.add(std::get<0>(property)->get(), me, std::get<1>(property));
+            }
 
             me->object_relations_[prop_i].second = std::get<1>(property);
             me->object_relations_[prop_i].probability = (float)std::get<2>(property) - 0.01f;
@@ -166,6 +176,7 @@ namespace ontologenius {
       {
         notifications_.emplace_back(notification_info, "[NEW]" + me->value() + ">" + std::get<0>(property)->value() + ":" + std::get<1>(property)->value());
         me->object_relations_.emplace_back(std::get<0>(property), std::get<1>(property), (float)std::get<2>(property) - 0.01);
+        ontology_->class_graph_.object_relations_index_.add(std::get<0>(property)->get(), me, std::get<1>(property));
       }
     }
 
@@ -175,6 +186,7 @@ namespace ontologenius {
       for(auto i : deduced_indexs)
       {
         notifications_.emplace_back(notification_info, "[DELETE]" + me->value() + ">" + me->object_relations_[i - deleted].first->value() + ":" + me->object_relations_[i - deleted].second->value());
+        ontology_->class_graph_.object_relations_index_.remove(me->object_relations_[i - deleted].first->get(), me, me->object_relations_[i - deleted].second);
         me->object_relations_.erase(me->object_relations_.begin() + (int)i - (int)deleted);
         deleted++;
       }
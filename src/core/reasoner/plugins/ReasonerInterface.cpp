@@ -1,11 +1,58 @@
 #include "ontologenius/core/reasoner/plugins/ReasonerInterface.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
-// make compiler happy !!!
+#include "ontologenius/core/ontoGraphs/Branchs/IndividualBranch.h"
 
 namespace ontologenius {
 
-  size_t ReasonerInterface::nb_update = 0;
+  std::vector<IndividualBranch*> ReasonerInterface::getIndividualsToCheck()
+  {
+    if(checkAllIndividuals())
+      return ontology_->individual_graph_.get();
+    else
+      return ontology_->individual_graph_.getUpdated();
+  }
+
+  std::vector<IndividualBranch*> ReasonerInterface::getIndividualsToCheck(const std::string& flag, std::unordered_set<index_t>& flagged)
+  {
+    if(checkAllIndividuals())
+      return ontology_->individual_graph_.get();
+
+    std::vector<IndividualBranch*> res = ontology_->individual_graph_.getUpdated();
+    for(auto it = flagged.begin(); it != flagged.end();)
+    {
+      IndividualBranch* indiv = ontology_->individual_graph_.findBranch(*it);
+      if((indiv == nullptr) || (indiv->flags_.find(flag) == indiv->flags_.end()))
+        it = flagged.erase(it);
+      else
+      {
+        res.push_back(indiv);
+        ++it;
+      }
+    }
+
+    std::sort(res.begin(), res.end(), [](IndividualBranch* a, IndividualBranch* b) { return a->get() < b->get(); });
+    res.erase(std::unique(res.begin(), res.end()), res.end());
+    return res;
+  }
+
+  bool ReasonerInterface::checkAllIndividuals()
+  {
+    // an updated property can concern the relations of any individual
+    if(first_check_ ||
+       ontology_->object_property_graph_.hasUpdated() ||
+       ontology_->data_property_graph_.hasUpdated())
+    {
+      first_check_ = false;
+      return true;
+    }
+    else
+      return false;
+  }
 
 } // namespace ontologenius
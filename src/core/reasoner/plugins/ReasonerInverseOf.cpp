@@ -16,7 +16,7 @@ namespace ontologenius {
   void ReasonerInverseOf::postReason()
   {
     const std::lock_guard<std::shared_timed_mutex> lock(ontology_->individual_graph_.mutex_);
-    for(const auto& indiv : ontology_->individual_graph_.get())
+    for(const auto& indiv : getIndividualsToCheck())
       if(indiv->updated_ || indiv->hasUpdatedObjectRelation())
       {
         for(const IndivObjectRelationElement& relation : indiv->object_relations_)
@@ -51,8 +51,8 @@ namespace ontologenius {
     try
     {
       int index = ontology_->individual_graph_.addRelation(indiv_on, inv_prop, inv_indiv, 1.0, true, false);
-      indiv_on->object_relations_[index].explanation = {inv_indiv->value() + "|" + base_prop->value() + "|" + indiv_on->value()};
-      indiv_on->nb_updates_++;
+      indiv_on->object_relations_[index].explanation = ontology_->explanation_table_.add({inv_indiv->value() + "|" + base_prop->value() + "|" + indiv_on->value()});
+      ontology_->individual_graph_.addUpdate(indiv_on);
 
       explanations_.emplace_back("[ADD]" + indiv_on->value() + "|" + inv_prop->value() + "|" + inv_indiv->value(),
                                  "[ADD]" + indiv_on->object_relations_[index].getExplanation());
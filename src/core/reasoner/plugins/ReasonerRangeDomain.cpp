@@ -29,7 +29,7 @@ namespace ontologenius {
     std::map<std::string, std::vector<std::string>>::iterator it_range;
     std::map<std::string, std::vector<std::string>>::iterator it_domain;
 
-    for(const auto& indiv : ontology_->individual_graph_.get())
+    for(const auto& indiv : getIndividualsToCheck())
       if(indiv->updated_ == true || indiv->hasUpdatedObjectRelation() || indiv->hasUpdatedDataRelation())
       {
         it_range = indiv->flags_.find("range");
@@ -109,8 +109,8 @@ namespace ontologenius {
         relation.second->is_a_.emplaceBack(range, 1.0, true);
         range->individual_childs_.emplace_back(relation.second, 1.0, true);
 
-        relation.second->nb_updates_++;
-        range->nb_updates_++;
+        ontology_->individual_graph_.addUpdate(relation.second);
+        ontology_->class_graph_.addUpdate(range);
         nb_update++;
       }
     }
@@ -157,8 +157,8 @@ namespace ontologenius {
         branch->is_a_.emplaceBack(domain, 1.0, true);
         domain->individual_childs_.emplace_back(branch, 1.0, true);
 
-        branch->nb_updates_++;
-        domain->nb_updates_++;
+        ontology_->individual_graph_.addUpdate(branch);
+        ontology_->class_graph_.addUpdate(domain);
         nb_update++;
       }
     }
@@ -205,8 +205,8 @@ namespace ontologenius {
         branch->is_a_.emplaceBack(domain, 1.0, true);
         domain->individual_childs_.emplace_back(branch, 1.0, true);
 
-        branch->nb_updates_++;
-        domain->nb_updates_++;
+        ontology_->individual_graph_.addUpdate(branch);
+        ontology_->class_graph_.addUpdate(domain);
         nb_update++;
       }
     }
@@ -215,7 +215,7 @@ namespace ontologenius {
   void ReasonerRangeDomain::postReasonClasses()
   {
     const std::lock_guard<std::shared_timed_mutex> lock(ontology_->class_graph_.mutex_);
-    const std::vector<ClassBranch*> classes = ontology_->class_graph_.get();
+    const std::vector<ClassBranch*> classes = ontology_->class_graph_.getUpdated();
 
     std::map<std::string, std::vector<std::string>>::iterator it_range;
     std::map<std::string, std::vector<std::string>>::iterator it_domain;
@@ -292,9 +292,10 @@ namespace ontologenius {
       {
         relation.second->mothers_.emplaceBack(range, 1.0, true);
         range->childs_.emplace_back(relation.second, 1.0, true);
+        ontology_->class_graph_.invalidateClosure(relation.second);
 
-        relation.second->nb_updates_++;
-        range->nb_updates_++;
+        ontology_->class_graph_.addUpdate(relation.second);
+        ontology_->class_graph_.addUpdate(range);
         nb_update++;
       }
     }
@@ -333,9 +334,10 @@ namespace ontologenius {
       {
         branch->mothers_.emplaceBack(domain, 1.0, true);
         domain->childs_.emplace_back(branch, 1.0, true);
+        ontology_->class_graph_.invalidateClosure(branch);
 
-        branch->nb_updates_++;
-        domain->nb_updates_++;
+        ontology_->class_graph_.addUpdate(branch);
+        ontology_->class_graph_.addUpdate(domain);
         nb_update++;
       }
     }
@@ -374,9 +376,10 @@ namespace ontologenius {
       {
         branch->mothers_.emplaceBack(domain, 1.0, true);
         domain->childs_.emplace_back(branch, 1.0, true);
+        ontology_->class_graph_.invalidateClosure(branch);
 
-        branch->nb_updates_++;
-        domain->nb_updates_++;
+        ontology_->class_graph_.addUpdate(branch);
+        ontology_->class_graph_.addUpdate(domain);
         nb_update++;
       }
     }
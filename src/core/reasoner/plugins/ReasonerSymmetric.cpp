@@ -16,7 +16,7 @@ namespace ontologenius {
   {
     const std::lock_guard<std::shared_timed_mutex> lock(ontology_->individual_graph_.mutex_);
     // not impacted by same as
-    for(const auto& indiv : ontology_->individual_graph_.get())
+    for(const auto& indiv : getIndividualsToCheck())
     {
       if(indiv->updated_ == true || indiv->hasUpdatedObjectRelation())
         for(auto& relation : indiv->object_relations_)
@@ -30,8 +30,8 @@ namespace ontologenius {
               try
               {
                 int index = ontology_->individual_graph_.addRelation(sym_indiv, sym_prop, indiv, 1.0, true, false);
-                sym_indiv->object_relations_[index].explanation = {indiv->value() + "|" + sym_prop->value() + "|" + sym_indiv->value()};
-                sym_indiv->nb_updates_++;
+                sym_indiv->object_relations_[index].explanation = ontology_->explanation_table_.add({indiv->value() + "|" + sym_prop->value() + "|" + sym_indiv->value()});
+                ontology_->individual_graph_.addUpdate(sym_indiv);
 
                 explanations_.emplace_back("[ADD]" + sym_indiv->value() + "|" + sym_prop->value() + "|" + indiv->value(),
                                            "[ADD]" + sym_indiv->object_relations_[index].getExplanation());
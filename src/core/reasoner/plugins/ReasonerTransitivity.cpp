@@ -22,7 +22,7 @@ namespace ontologenius {
     const std::lock_guard<std::shared_timed_mutex> lock(ontology_->individual_graph_.mutex_);
     const std::lock_guard<std::shared_timed_mutex> lock_prop(ontology_->object_property_graph_.mutex_);
 
-    for(auto* indiv : ontology_->individual_graph_.get())
+    for(auto* indiv : getIndividualsToCheck("transi", flagged_))
       if((indiv->updated_ == true) || (indiv->flags_.find("transi") != indiv->flags_.end()) || indiv->hasUpdatedObjectRelation())
       {
         bool has_active_transitivity = false;
@@ -52,7 +52,7 @@ namespace ontologenius {
                   try
                   {
                     index = ontology_->individual_graph_.addRelation(indiv, property, used.first, 1.0, true, false);
-                    indiv->nb_updates_++;
+                    ontology_->individual_graph_.addUpdate(indiv);
                   }
                   catch(GraphException& e)
                   {
@@ -61,10 +61,11 @@ namespace ontologenius {
                   }
 
                   used.second.insert(used.second.end(), local_used.begin(), local_used.end());
-                  indiv->object_relations_[index].explanation.reserve(used.second.size());
+                  std::vector<std::string> explanation;
+                  explanation.reserve(used.second.size());
                   for(auto it = used.second.rbegin(); it != used.second.rend(); ++it)
                   {
-                    indiv->object_relations_[index].explanation.push_back(it->first);
+                    explanation.push_back(it->first);
 
                     if(it->second->exist(indiv, property, used.first) == false)
                     {
@@ -73,6 +74,8 @@ namespace ontologenius {
                     }
                   }
 
+                  indiv->object_relations_[index].explanation = ontology_->explanation_table_.add(explanation);
+
                   nb_update++;
                   explanations_.emplace_back("[ADD]" + indiv->value() + "|" + property->value() + "|" + used.first->value(),
                                              "[ADD]" + indiv->object_relations_[index].getExplanation());
@@ -84,9 +87,15 @@ namespace ontologenius {
 
         // To prevent the transitivity chain to be triggered only when the first relation is added
         if(has_active_transitivity)
+        {
           indiv->flags_["transi"] = {};
+          flagged_.insert(indiv->get());
+        }
         else
+        {
           indiv->flags_.erase("transi");
+          flagged_.erase(indiv->get());
+        }
       }
   }
 
@@ -150,17 +159,8 @@ namespace ontologenius {
 
   bool ReasonerTransitivity::relationExists(IndividualBranch* indiv_from, ObjectPropertyBranch* property, IndividualBranch* indiv_on)
   {
-    for(auto& relation : indiv_from->object_relations_)
-    {
-      if(relation.second->get() == indiv_on->get())
-      {
-        std::unordered_set<ObjectPropertyBranch*> down_properties;
-        ontology_->object_property_graph_.getDownPtr(property, down_properties);
-        if(down_properties.find(relation.first) != down_properties.end())
-          return true;
-      }
-    }
-    return false;
+    // the index holds the relations of the sub-properties under their super-properties
+    return ontology_->individual_graph_.object_relations_index_.contains(property->get(), indiv_from, indiv_on);
   }
 
   std::string ReasonerTransitivity::getName()
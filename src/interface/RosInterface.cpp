@@ -1,8 +1,12 @@
 #include "ontologenius/interface/RosInterface.h"
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <thread>
 #include <unordered_set>
@@ -17,8 +21,12 @@
 #define PUB_QUEU_SIZE 1000
 #define SUB_QUEU_SIZE 10000
 
-#define FEEDER_DEFAULT_RATE 20
-#define FEEDER_COPY_RATE 4000
+#define FEEDER_INIT_RATE 20
+#define FEEDER_IDLE_TIMEOUT_MS 500
+#define FEEDER_DEFAULT_LATENCY_MS 5
+#define FEEDER_COPY_LATENCY_MS 0
+
+#define READ_VIEW_DEFAULT_PERIOD_MS 1000
 
 namespace ontologenius {
 
@@ -31,9 +39,15 @@ namespace ontologenius {
 #endif
                                                         name_(name),
                                                         run_(true),
-                                                        feeder_rate_(FEEDER_DEFAULT_RATE),
+                                                        feeder_latency_(FEEDER_DEFAULT_LATENCY_MS),
                                                         feeder_end_pub_(getTopicName("end", name), PUB_QUEU_SIZE),
-                                                        display_(true)
+                                                        display_(true),
+                                                        deterministic_names_(false),
+                                                        snapshot_reads_(false),
+                                                        read_view_outdated_(true),
+                                                        read_view_requested_(false),
+                                                        feeding_(false),
+                                                        read_view_period_(READ_VIEW_DEFAULT_PERIOD_MS)
   {
     onto_->setDisplay(display_);
     reasoners_.link(onto_);
@@ -53,9 +67,15 @@ namespace ontologenius {
 #endif
                                                                              name_(name),
                                                                              run_(true),
-                                                                             feeder_rate_(FEEDER_DEFAULT_RATE),
+                                                                             feeder_latency_(FEEDER_DEFAULT_LATENCY_MS),
                                                                              feeder_end_pub_(getTopicName("end", name), PUB_QUEU_SIZE),
-                                                                             display_(true)
+                                                                             display_(true),
+                                                                             deterministic_names_(false),
+                                                                             snapshot_reads_(false),
+                                                                             read_view_outdated_(true),
+                                                                             read_view_requested_(false),
+                                                                             feeding_(false),
+                                                                             read_view_period_(READ_VIEW_DEFAULT_PERIOD_MS)
   {
     other.lock();
     onto_->setDisplay(display_);
@@ -94,8 +114,6 @@ namespace ontologenius {
     reasoners_.configure(config_path);
     reasoners_.load();
     Display::info("Plugins loaded : " + reasoners_.list());
-
-    feeder_rate_ = FEEDER_DEFAULT_RATE;
   }
 
   void RosInterface::init(const std::string& lang, const std::string& config_path)
@@ -107,7 +125,7 @@ namespace ontologenius {
     Display::info("Plugins loaded : " + reasoners_.list());
 
     feeder_.activateVersionning(true);
-    feeder_rate_ = FEEDER_COPY_RATE;
+    feeder_latency_ = FEEDER_COPY_LATENCY_MS;
   }
 
   void RosInterface::run()
@@ -126,6 +144,13 @@ namespace ontologenius {
       this);
     (void)sub_insert_stamped;
 
+    auto sub_insert_facts = compat::onto_ros::Subscriber<compat::OntologeniusFactArray>(
+      getTopicName("insert_facts"),
+      PUB_QUEU_SIZE,
+      &RosInterface::factsCallback,
+      this);
+    (void)sub_insert_facts;
+
     std::vector<compat::onto_ros::Service<compat::OntologeniusService>> str_services;
     str_services.emplace_back(getTopicName("actions"), &RosInterface::actionsHandle, this);
     str_services.emplace_back(getTopicName("reasoner"), &RosInterface::reasonerHandle, this);
@@ -156,6 +181,7 @@ namespace ontologenius {
     std::thread feed_thread(&RosInterface::feedThread, this);
     std::thread periodic_reasoning_thread(&RosInterface::periodicReasoning, this);
     std::thread subscription_thread(&SubscriptionManager::run, &subscriber_);
+    std::thread read_view_thread(&RosInterface::readViewThread, this);
 
     if(name_.empty() == false)
       Display::info(name_ + " is ready");
@@ -164,6 +190,7 @@ namespace ontologenius {
 
     periodic_reasoning_thread.join();
     feed_thread.join();
+    read_view_thread.join();
     subscriber_.stop();
     subscription_thread.join();
   }
@@ -172,6 +199,8 @@ namespace ontologenius {
   {
     // node_handle->now();
     run_ = false;
+    feeder_.notify();
+    read_view_cv_.notify_all();
     /*callback_queue_.disable();
     callback_queue_.clear();*/
   }
@@ -180,10 +209,12 @@ namespace ontologenius {
   {
     feeder_mutex_.lock();
     reasoner_mutex_.lock();
+    read_view_mutex_.lock();
   }
 
   void RosInterface::release()
   {
+    read_view_mutex_.unlock();
     reasoner_mutex_.unlock();
     feeder_mutex_.unlock();
   }
@@ -208,6 +239,12 @@ namespace ontologenius {
     onto_->setDisplay(display_);
   }
 
+  void RosInterface::setDeterministicNames(bool deterministic)
+  {
+    deterministic_names_ = deterministic;
+    onto_->setDeterministicNames(deterministic_names_);
+  }
+
   /***************
    *
    * Callbacks
@@ -226,6 +263,39 @@ namespace ontologenius {
     feeder_.store(msg->data, {msg->stamp.seconds, msg->stamp.nanoseconds});
   }
 
+  void RosInterface::factsCallback(const compat::onto_ros::MessageWrapper<compat::OntologeniusFactArray>& msg)
+  {
+    std::vector<Feed_t> feeds;
+    feeds.reserve(msg->facts.size());
+    for(const auto& fact : msg->facts)
+    {
+      Feed_t feed;
+      if(fact.action == compat::OntologeniusFact::ADD)
+        feed.action_ = action_add;
+      else if(fact.action == compat::OntologeniusFact::DEL)
+        feed.action_ = action_del;
+      else
+      {
+        Display::error("[insert_facts] unknown action " + std::to_string(fact.action));
+        continue;
+      }
+
+      feed.stamp = {fact.stamp.seconds, fact.stamp.nanoseconds};
+      feed.from_ = fact.subject;
+      feed.prop_ = fact.property;
+      feed.on_ = fact.object;
+      feed.from_index_ = fact.subject_index;
+      feed.prop_index_ = fact.property_index;
+      feed.on_index_ = fact.object_index;
+      // the facts out of [0, 1] are rejected by the feeder, for the failure to be notified
+      if(fact.probability != 0)
+        feed.probability_ = fact.probability;
+      feeds.push_back(feed);
+    }
+
+    feeder_.store(feeds);
+  }
+
   bool RosInterface::actionsHandle(compat::onto_ros::ServiceWrapper<compat::OntologeniusService::Request>& req,
                                    compat::onto_ros::ServiceWrapper<compat::OntologeniusService::Response>& res)
   {
@@ -254,6 +324,7 @@ namespace ontologenius {
         delete onto_;
         onto_ = new Ontology();
         onto_->setDisplay(display_);
+        onto_->setDeterministicNames(deterministic_names_);
         reasoners_.link(onto_);
         feeder_.link(onto_);
         subscriber_.link(onto_);
@@ -262,6 +333,8 @@ namespace ontologenius {
         if(onto_->preload(intern_file_) == false)
           for(auto& file : files_)
             onto_->readFromFile(file);
+        if(snapshot_reads_ == true)
+          publishReadView(); // the previous view must not outlive the reset
         release();
       }
       else if(req->action == "clear")
@@ -270,10 +343,13 @@ namespace ontologenius {
         delete onto_;
         onto_ = new Ontology();
         onto_->setDisplay(display_);
+        onto_->setDeterministicNames(deterministic_names_);
         reasoners_.link(onto_);
         feeder_.link(onto_);
         subscriber_.link(onto_);
         sparql_.link(onto_);
+        if(snapshot_reads_ == true)
+          publishReadView();
         release();
       }
       else if(req->action == "setLang")
@@ -283,6 +359,10 @@ namespace ontologenius {
       else
         res->code = UNKNOW_ACTION;
 
+      if((req->action != "save") && (req->action != "export") && (req->action != "getLang") &&
+         (req->action != "reset") && (req->action != "clear"))
+        read_view_outdated_ = true;
+
       return true;
     }(compat::onto_ros::getServicePointer(req), compat::onto_ros::getServicePointer(res));
   }
@@ -367,7 +447,7 @@ namespace ontologenius {
     end_feed_ = false;
 #endif
 
-    compat::onto_ros::Rate wait((double)feeder_rate_);
+    compat::onto_ros::Rate wait(FEEDER_INIT_RATE);
     while(compat::onto_ros::Node::ok() && (onto_->isInit(false) == false) && (run_ == true))
     {
       wait.sleep();
@@ -392,7 +472,10 @@ namespace ontologenius {
       if((run == true) && (run_ == true))
       {
         if(feeder_end == true)
+        {
           feeder_end = false;
+          feeding_ = true;
+        }
 
         const std::vector<std::string> notifications = feeder_.getNotifications();
         for(auto notif : notifications)
@@ -418,6 +501,9 @@ namespace ontologenius {
         reasoner_mutex_.lock();
         reasoners_.runPostReasoners();
         reasoner_mutex_.unlock();
+        // once outdated, the read view is not used for the queries to see the fed facts
+        read_view_outdated_ = true;
+        feeding_ = false;
 #ifdef ONTO_TEST
         end_feed_ = true;
 #endif
@@ -430,10 +516,17 @@ namespace ontologenius {
       if((run == true) && (run_ == true))
         feeder_echo_.publish();
 
+      if(run == true)
+        read_view_outdated_ = true;
+
       feeder_mutex_.unlock();
 
+      // sleeps until new facts arrive and lets a burst gather within the latency budget
       if(compat::onto_ros::Node::ok() && (run_ == true) && (run == false))
-        wait.sleep();
+      {
+        if(feeder_.waitFeeds(std::chrono::milliseconds(FEEDER_IDLE_TIMEOUT_MS)) && (feeder_latency_ > 0))
+          std::this_thread::sleep_for(std::chrono::milliseconds(feeder_latency_));
+      }
     }
   }
 
@@ -474,6 +567,8 @@ namespace ontologenius {
       }
 
       auto explanations = reasoners_.getExplanations();
+      if(explanations.empty() == false)
+        read_view_outdated_ = true;
       subscriber_.add(explanations);
       for(auto& explanation : explanations)
       {
@@ -489,6 +584,89 @@ namespace ontologenius {
     }
   }
 
+  void RosInterface::readViewThread()
+  {
+    while(compat::onto_ros::Node::ok() && (run_ == true))
+    {
+      {
+        std::unique_lock<std::mutex> lock(read_view_request_mutex_);
+        read_view_cv_.wait_for(lock, std::chrono::milliseconds(FEEDER_IDLE_TIMEOUT_MS),
+                               [this]() { return read_view_requested_ || (run_ == false); });
+        if(read_view_requested_ == false)
+          continue;
+        read_view_requested_ = false;
+      }
+
+      // the requests arriving meanwhile are answered by the same copy
+      read_view_mutex_.lock();
+      auto next_date = read_view_date_ + std::chrono::milliseconds(read_view_period_);
+      read_view_mutex_.unlock();
+      std::this_thread::sleep_until(next_date);
+
+      const std::lock_guard<std::mutex> lock(read_view_mutex_);
+      if((run_ == true) && (snapshot_reads_ == true) && (read_view_outdated_ == true))
+        publishReadView();
+    }
+  }
+
+  void RosInterface::publishReadView()
+  {
+    // the modifications made during the copy will mark it outdated again
+    read_view_outdated_ = false;
+
+    std::shared_ptr<Ontology> view;
+    if(onto_->isInit(false))
+    {
+      // All the graphs are copied, not only the modified ones, as their branchs point to each other.
+      // The shared locks are taken in the order of the writers, which wait for the end of the copy.
+      const std::shared_lock<std::shared_timed_mutex> lock_indiv(onto_->individual_graph_.mutex_);
+      const std::shared_lock<std::shared_timed_mutex> lock_class(onto_->class_graph_.mutex_);
+      const std::shared_lock<std::shared_timed_mutex> lock_object(onto_->object_property_graph_.mutex_);
+      const std::shared_lock<std::shared_timed_mutex> lock_data(onto_->data_property_graph_.mutex_);
+      const std::shared_lock<std::shared_timed_mutex> lock_anonymous(onto_->anonymous_graph_.mutex_);
+      view = std::make_shared<Ontology>(*onto_);
+    }
+    if(view != nullptr)
+      view->setDisplay(false);
+
+    // the previous view is released by its last reader
+    std::atomic_store(&read_view_, view);
+    read_view_date_ = std::chrono::steady_clock::now();
+  }
+
+  void RosInterface::requestReadView()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(read_view_request_mutex_);
+      read_view_requested_ = true;
+    }
+    read_view_cv_.notify_one();
+  }
+
+  std::shared_ptr<Ontology> RosInterface::getReadView(bool updated)
+  {
+    if(updated == true)
+    {
+      read_view_outdated_ = true;
+      if(snapshot_reads_ == true)
+        requestReadView();
+    }
+    else if(snapshot_reads_ == true)
+    {
+      // An outdated view is only used during a continuous feeding, being at most read_view_period_ old.
+      // Once the feeding ended, the queries are answered on the working ontology until the view is refreshed.
+      const bool outdated = read_view_outdated_;
+      if(outdated == true)
+        requestReadView();
+      auto view = std::atomic_load(&read_view_);
+      if((view != nullptr) && ((outdated == false) || (feeding_ == true)))
+        return view;
+    }
+
+    // does not own the working ontology
+    return std::shared_ptr<Ontology>(std::shared_ptr<Ontology>(), onto_);
+  }
+
   /***************
    *
    * Utility
@@ -86,6 +86,10 @@ void addInterface(const std::string& name, bool is_root = false)
     files.push_back(params.at("human_file").getFirst());
 
   tmp->setDisplay(params.at("display").getFirst() == "true");
+  tmp->setDeterministicNames(params.at("deterministic_names").getFirst() == "true");
+  tmp->setSnapshotReads(params.at("snapshot").getFirst() == "true");
+  tmp->setSnapshotPeriod(params.at("snapshot_period").getFirstUnsigned());
+  tmp->setFeederLatency(params.at("feeder_latency").getFirstUnsigned());
   tmp->init(params.at("language").getFirst(),
             params.at("intern_file").getFirst(),
             files,
@@ -185,6 +189,9 @@ bool managerHandle(ontologenius::compat::onto_ros::ServiceWrapper<ontologenius::
                 auto* tmp = new ontologenius::RosInterface(*(interfaces[base_name]), copy_name);
                 interfaces[copy_name] = tmp;
                 tmp->setDisplay(params.at("display").getFirst() == "true");
+                tmp->setDeterministicNames(params.at("deterministic_names").getFirst() == "true");
+                tmp->setSnapshotReads(params.at("snapshot").getFirst() == "true");
+                tmp->setSnapshotPeriod(params.at("snapshot_period").getFirstUnsigned());
                 tmp->init(params.at("language").getFirst(),
                           params.at("config").getFirst());
 
@@ -238,6 +245,10 @@ int main(int argc, char** argv)
   params.insert(ontologenius::Parameter("intern_file", {"-i", "--intern_file"}, {"none"}));
   params.insert(ontologenius::Parameter("config", {"-c", "--config"}, {"none"}));
   params.insert(ontologenius::Parameter("display", {"-d", "--display"}, {"true"}));
+  params.insert(ontologenius::Parameter("deterministic_names", {"-dn", "--deterministic_names"}, {"false"}));
+  params.insert(ontologenius::Parameter("snapshot", {"-s", "--snapshot"}, {"false"}));
+  params.insert(ontologenius::Parameter("snapshot_period", {"-sp", "--snapshot_period"}, {"1000"}));
+  params.insert(ontologenius::Parameter("feeder_latency", {"-fl", "--feeder_latency"}, {"5"}));
   params.insert(ontologenius::Parameter("human_file", {"-h", "--human"}, {"none"}));
   params.insert(ontologenius::Parameter("robot_file", {"-r", "--robot"}, {"none"}));
   params.insert(ontologenius::Parameter("root", {"--root"}, {"none"}));
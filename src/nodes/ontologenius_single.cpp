@@ -4,6 +4,7 @@
 #include <cstdlib>
 #include <execinfo.h>
 #include <ontologenius/compat/ros.h>
+#include <string>
 #include <thread>
 #include <unistd.h>
 
@@ -36,12 +37,20 @@ int main(int argc, char** argv)
     params.insert(ontologenius::Parameter("intern_file", {"-i", "--intern_file"}, {"none"}));
     params.insert(ontologenius::Parameter("config", {"-c", "--config"}, {"none"}));
     params.insert(ontologenius::Parameter("display", {"-d", "--display"}, {"true"}));
+    params.insert(ontologenius::Parameter("deterministic_names", {"-dn", "--deterministic_names"}, {"false"}));
+    params.insert(ontologenius::Parameter("snapshot", {"-s", "--snapshot"}, {"false"}));
+    params.insert(ontologenius::Parameter("snapshot_period", {"-sp", "--snapshot_period"}, {"1000"}));
+    params.insert(ontologenius::Parameter("feeder_latency", {"-fl", "--feeder_latency"}, {"5"}));
     params.insert(ontologenius::Parameter("files", {}));
 
     params.set(argc, argv);
     params.display();
 
     interface.setDisplay(params.at("display").getFirst() == "true");
+    interface.setDeterministicNames(params.at("deterministic_names").getFirst() == "true");
+    interface.setSnapshotReads(params.at("snapshot").getFirst() == "true");
+    interface.setSnapshotPeriod(params.at("snapshot_period").getFirstUnsigned());
+    interface.setFeederLatency(params.at("feeder_latency").getFirstUnsigned());
     interface.init(params.at("language").getFirst(),
                    params.at("intern_file").getFirst(),
                    params.at("files").get(),
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "ontologenius/core/ontoGraphs/Ontology.h"
+#include "ontologenius/utils/Commands.h"
+
+#define UNCACHED_DEPTH 1000
+
+// getUp and getDown without depth are answered from the closures cache
+// while a finite depth always walks the graph
+void checkClosures(ontologenius::Ontology& onto)
+{
+  for(auto& class_name : onto.class_graph_.getAll())
+  {
+    EXPECT_EQ(onto.class_graph_.getUp(class_name), onto.class_graph_.getUp(class_name, UNCACHED_DEPTH)) << class_name;
+    EXPECT_EQ(onto.class_graph_.getDown(class_name), onto.class_graph_.getDown(class_name, UNCACHED_DEPTH)) << class_name;
+  }
+
+  for(auto& indiv_name : onto.individual_graph_.getAll())
+    EXPECT_EQ(onto.individual_graph_.getUp(indiv_name), onto.individual_graph_.getUp(indiv_name, UNCACHED_DEPTH)) << indiv_name;
+}
+
+TEST(feature_closure, cached_uncached)
+{
+  ontologenius::Ontology onto;
+  onto.setDisplay(false);
+
+  const std::string path_base = ontologenius::findPackage("ontologenius");
+  onto.readFromFile(path_base + "/files/attribute.owl");
+  onto.readFromFile(path_base + "/files/positionProperty.owl");
+  onto.readFromFile(path_base + "/files/test_individuals.owl");
+  onto.close();
+
+  checkClosures(onto);
+
+  // the cache has to follow the modifications of the taxonomy
+  onto.class_graph_.addInheritage("Kitchen", "vegetal");
+  checkClosures(onto);
+  EXPECT_EQ(onto.class_graph_.getUp("Kitchen").count("living"), 1);
+
+  onto.class_graph_.addInheritage("entity", "sensor");
+  checkClosures(onto);
+
+  onto.class_graph_.removeInheritage("Kitchen", "vegetal");
+  checkClosures(onto);
+  EXPECT_EQ(onto.class_graph_.getUp("Kitchen").count("living"), 0);
+
+  onto.individual_graph_.addInheritage("red_cube", "tree");
+  checkClosures(onto);
+
+  onto.class_graph_.removeInheritage("tree", "vegetal");
+  checkClosures(onto);
+}
+
+// the readers share the cache and fill it concurrently
+TEST(feature_closure, concurrent_readers)
+{
+  ontologenius::Ontology onto;
+  onto.setDisplay(false);
+
+  const std::string path_base = ontologenius::findPackage("ontologenius");
+  onto.readFromFile(path_base + "/files/attribute.owl");
+  onto.readFromFile(path_base + "/files/positionProperty.owl");
+  onto.readFromFile(path_base + "/files/test_individuals.owl");
+  onto.close();
+
+  const std::vector<std::string> all_classes = onto.class_graph_.getAll();
+  const std::unordered_set<std::string> classes(all_classes.begin(), all_classes.end());
+  std::vector<std::unordered_set<std::string>> expected_ups;
+  for(auto& class_name : classes)
+    expected_ups.push_back(onto.class_graph_.getUp(class_name, UNCACHED_DEPTH));
+  const std::unordered_set<std::string> expected_livings = onto.class_graph_.select(classes, std::string("living"));
+
+  std::vector<std::thread> readers;
+  std::vector<size_t> errors(4, 0);
+  for(size_t reader_i = 0; reader_i < errors.size(); reader_i++)
+    readers.emplace_back([&, reader_i]() {
+      for(size_t loop = 0; loop < 10; loop++)
+      {
+        onto.class_graph_.invalidateClosure();
+        size_t class_i = 0;
+        for(auto& class_name : classes)
+          if(onto.class_graph_.getUp(class_name) != expected_ups[class_i++])
+            errors[reader_i]++;
+        if(onto.class_graph_.select(classes, std::string("living")) != expected_livings)
+          errors[reader_i]++;
+      }
+    });
+
+  for(auto& reader : readers)
+    reader.join();
+
+  for(const size_t error : errors)
+    EXPECT_EQ(error, 0);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <ros/ros.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "ontologenius/API/ontologenius/OntologyManipulatorIndex.h"
+
+#define WAIT_TIME 1000 // ms
+#define UNKNOWN_INDEX 999999
+
+onto::OntologyManipulatorIndex* onto_ptr;
+std::mutex notifications_mutex;
+std::vector<std::string> notifications;
+
+void feederNotificationCallback(const std::string& notification)
+{
+  const std::lock_guard<std::mutex> lock(notifications_mutex);
+  notifications.push_back(notification);
+}
+
+size_t countNotifications(const std::string& failure)
+{
+  const std::lock_guard<std::mutex> lock(notifications_mutex);
+  return std::count_if(notifications.begin(), notifications.end(), [&failure](const std::string& notification) {
+    return notification.find(failure) != std::string::npos;
+  });
+}
+
+ontologenius::compat::OntologeniusFact createFact(int64_t subject_index, int64_t property_index, int64_t object_index, double probability = 1.0)
+{
+  ontologenius::compat::OntologeniusFact fact;
+  fact.action = ontologenius::compat::OntologeniusFact::ADD;
+  fact.subject_index = subject_index;
+  fact.property_index = property_index;
+  fact.object_index = object_index;
+  fact.probability = probability;
+  return fact;
+}
+
+bool hasRelation(int64_t subject_index, int64_t property_index, int64_t object_index)
+{
+  auto res = onto_ptr->individuals.getOn(subject_index, property_index);
+  return std::find(res.begin(), res.end(), object_index) != res.end();
+}
+
+TEST(feature_facts, names_and_indexes)
+{
+  onto_ptr->feeder.addConcept("bob");
+  onto_ptr->feeder.addConcept("alice");
+  onto_ptr->feeder.addRelation("table", "isNear", "chair");
+  onto_ptr->feeder.addRelation("table", "hasLeg", "integer#4");
+  onto_ptr->feeder.waitUpdate(WAIT_TIME);
+
+  const int64_t bob = onto_ptr->conversion.individualsId2Index("bob");
+  const int64_t alice = onto_ptr->conversion.individualsId2Index("alice");
+  const int64_t table = onto_ptr->conversion.individualsId2Index("table");
+  const int64_t chair = onto_ptr->conversion.individualsId2Index("chair");
+  const int64_t is_near = onto_ptr->conversion.objectPropertiesId2Index("isNear");
+  const int64_t has_leg = onto_ptr->conversion.dataPropertiesId2Index("hasLeg");
+  const int64_t four = onto_ptr->conversion.literalsId2Index("integer#4");
+  ASSERT_GT(bob, 0);
+  ASSERT_GT(is_near, 0);
+  ASSERT_LT(four, 0);
+
+  std::vector<ontologenius::compat::OntologeniusFact> facts;
+  // only indexes
+  facts.push_back(createFact(bob, is_near, table));
+  // a given name prevails over the index
+  facts.push_back(createFact(bob, is_near, table));
+  facts.back().subject = "alice";
+  // negative index of a literal
+  facts.push_back(createFact(alice, has_leg, four));
+  // a null probability stands for a certain fact
+  facts.push_back(createFact(chair, is_near, bob, 0.));
+
+  onto_ptr->feeder.publishFacts(facts);
+  onto_ptr->feeder.waitUpdate(WAIT_TIME);
+  usleep(500000); // lets the notifications come
+
+  EXPECT_TRUE(hasRelation(bob, is_near, table));
+  EXPECT_TRUE(hasRelation(alice, is_near, table));
+  EXPECT_TRUE(hasRelation(alice, has_leg, four));
+  EXPECT_TRUE(hasRelation(chair, is_near, bob));
+  EXPECT_EQ(countNotifications("[FAIL]"), 0);
+}
+
+TEST(feature_facts, rejected_facts)
+{
+  const int64_t bob = onto_ptr->conversion.individualsId2Index("bob");
+  const int64_t chair = onto_ptr->conversion.individualsId2Index("chair");
+  const int64_t is_near = onto_ptr->conversion.objectPropertiesId2Index("isNear");
+  const int64_t has_leg = onto_ptr->conversion.dataPropertiesId2Index("hasLeg");
+
+  std::vector<ontologenius::compat::OntologeniusFact> facts;
+  facts.push_back(createFact(UNKNOWN_INDEX, is_near, chair));
+  facts.push_back(createFact(bob, UNKNOWN_INDEX, chair));
+  facts.push_back(createFact(bob, is_near, UNKNOWN_INDEX));
+  facts.push_back(createFact(bob, has_leg, -UNKNOWN_INDEX));
+  facts.push_back(createFact(bob, is_near, chair, 1.5));
+  facts.push_back(createFact(bob, is_near, chair, -0.5));
+
+  onto_ptr->feeder.publishFacts(facts);
+  onto_ptr->feeder.waitUpdate(WAIT_TIME);
+  usleep(500000); // lets the notifications come
+
+  EXPECT_FALSE(hasRelation(bob, is_near, chair));
+  EXPECT_TRUE(onto_ptr->individuals.getOn(bob, has_leg).empty());
+  EXPECT_EQ(countNotifications("[FAIL][unknown index]"), 4);
+  EXPECT_EQ(countNotifications("out of [0, 1]]"), 2);
+}
+
+int main(int argc, char** argv)
+{
+  ros::init(argc, argv, "ontologenius_feature_facts_test");
+
+  std::thread ros_thread([]() { ros::spin(); });
+
+  onto::OntologyManipulatorIndex onto;
+  onto_ptr = &onto;
+
+  onto.close();
+  onto.feeder.registerFeederNotificationCallback(&feederNotificationCallback);
+  onto.feeder.waitConnected();
+
+  testing::InitGoogleTest(&argc, argv);
+  const int res = RUN_ALL_TESTS();
+
+  ros::shutdown();
+  ros_thread.join();
+  return res;
+}
@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "ontologenius/core/ontoGraphs/Ontology.h"
+
+// The incoming relations of each individual have to be the ones found by scanning the whole A-box
+void checkIncomingRelations(ontologenius::Ontology& onto)
+{
+  for(auto* indiv : onto.individual_graph_.get())
+  {
+    std::vector<std::pair<ontologenius::ObjectPropertyBranch*, ontologenius::IndividualBranch*>> expected;
+    for(auto* subject : onto.individual_graph_.get())
+      for(auto& relation : subject->object_relations_)
+        if(relation.second == indiv)
+          expected.emplace_back(relation.first, subject);
+
+    auto incomings = indiv->incoming_object_relations_;
+    std::sort(expected.begin(), expected.end());
+    std::sort(incomings.begin(), incomings.end());
+    EXPECT_EQ(incomings, expected) << indiv->value();
+  }
+}
+
+TEST(feature_incoming_relations, add_remove)
+{
+  ontologenius::Ontology onto;
+  onto.setDisplay(false);
+  onto.close();
+
+  auto* cube = onto.individual_graph_.findOrCreateBranchSafe("cube");
+  auto* ball = onto.individual_graph_.findOrCreateBranchSafe("ball");
+  onto.individual_graph_.addRelation(cube, "isOn", "table");
+  onto.individual_graph_.addRelation(ball, "isOn", "table");
+  onto.individual_graph_.addRelation(ball, "isNextTo", "table");
+  onto.individual_graph_.addRelation(cube, "isNextTo", "ball");
+  checkIncomingRelations(onto);
+
+  EXPECT_EQ(onto.individual_graph_.getRelationOn("table"), std::unordered_set<std::string>({"isOn", "isNextTo"}));
+  EXPECT_EQ(onto.individual_graph_.getRelationOn("ball"), std::unordered_set<std::string>({"isNextTo"}));
+  EXPECT_TRUE(onto.individual_graph_.getRelationOn("cube").empty());
+  EXPECT_EQ(onto.individual_graph_.getFrom("table", "isOn"), std::unordered_set<std::string>({"cube", "ball"}));
+
+  onto.individual_graph_.removeRelation("ball", "isOn", "table");
+  checkIncomingRelations(onto);
+  EXPECT_EQ(onto.individual_graph_.getRelationOn("table"), std::unordered_set<std::string>({"isOn", "isNextTo"}));
+  EXPECT_EQ(onto.individual_graph_.getFrom("table", "isOn"), std::unordered_set<std::string>({"cube"}));
+
+  onto.individual_graph_.removeRelation("cube", "isOn", "table");
+  checkIncomingRelations(onto);
+  EXPECT_EQ(onto.individual_graph_.getRelationOn("table"), std::unordered_set<std::string>({"isNextTo"}));
+  EXPECT_TRUE(onto.individual_graph_.getFrom("table", "isOn").empty());
+
+  // the copy has its own incoming relations
+  ontologenius::Ontology copy = onto;
+  copy.setDisplay(false);
+  checkIncomingRelations(copy);
+  EXPECT_EQ(copy.individual_graph_.getRelationOn("ball"), std::unordered_set<std::string>({"isNextTo"}));
+}
+
+TEST(feature_incoming_relations, delete_individual)
+{
+  ontologenius::Ontology onto;
+  onto.setDisplay(false);
+  onto.close();
+
+  auto* cube = onto.individual_graph_.findOrCreateBranchSafe("cube");
+  auto* ball = onto.individual_graph_.findOrCreateBranchSafe("ball");
+  onto.individual_graph_.addRelation(cube, "isOn", "table");
+  onto.individual_graph_.addRelation(ball, "isOn", "table");
+  onto.individual_graph_.addRelation(cube, "isNextTo", "ball");
+  onto.individual_graph_.addRelation(ball, "isNextTo", "cube");
+  onto.individual_graph_.addRelation(cube, "isNextTo", "cube");
+
+  // the subject of relations
+  onto.individual_graph_.deleteIndividual(onto.individual_graph_.findBranchSafe("cube"));
+  checkIncomingRelations(onto);
+  EXPECT_EQ(onto.individual_graph_.getRelationOn("table"), std::unordered_set<std::string>({"isOn"}));
+  EXPECT_EQ(onto.individual_graph_.getFrom("table", "isOn"), std::unordered_set<std::string>({"ball"}));
+  EXPECT_TRUE(onto.individual_graph_.getRelationOn("ball").empty());
+
+  // the object of relations
+  onto.individual_graph_.deleteIndividual(onto.individual_graph_.findBranchSafe("table"));
+  checkIncomingRelations(onto);
+  EXPECT_EQ(onto.individual_graph_.getOn("ball", "isOn").size(), 0);
+
+  onto.individual_graph_.addRelation(ball, "isOn", "table");
+  checkIncomingRelations(onto);
+  EXPECT_EQ(onto.individual_graph_.getRelationOn("table"), std::unordered_set<std::string>({"isOn"}));
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,102 @@
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "ontologenius/core/ontoGraphs/Branchs/Triplet.h"
+#include "ontologenius/core/ontoGraphs/Ontology.h"
+
+#define NB_INDUCED 40 // over the size from which the triplets are hashed
+
+using ObjectTriplets = ontologenius::Triplets<ontologenius::IndividualBranch, ontologenius::ObjectPropertyBranch, ontologenius::IndividualBranch>;
+
+std::vector<ontologenius::IndividualBranch*> createIndividuals(ontologenius::Ontology& onto, size_t nb)
+{
+  std::vector<ontologenius::IndividualBranch*> res;
+  for(size_t i = 0; i < nb; i++)
+    res.push_back(onto.individual_graph_.findOrCreateBranchSafe("indiv_" + std::to_string(i)));
+  return res;
+}
+
+TEST(feature_inductions, triplets_erase)
+{
+  ontologenius::Ontology onto;
+  onto.setDisplay(false);
+  onto.close();
+
+  auto indivs = createIndividuals(onto, NB_INDUCED);
+  auto* table = onto.individual_graph_.findOrCreateBranchSafe("table");
+  auto* property = onto.object_property_graph_.findOrCreateBranch("isNear");
+
+  ObjectTriplets triplets;
+  for(auto* indiv : indivs)
+    triplets.push(indiv, property, table);
+  for(auto* indiv : indivs)
+    triplets.push(indiv, property, table);
+  EXPECT_EQ(triplets.size(), NB_INDUCED);
+
+  // erasing one triplet out of three then the others goes over and under the hashing size
+  for(size_t step : {3, 1})
+    for(size_t i = 0; i < indivs.size(); i += step)
+    {
+      if(triplets.exist(indivs[i], property, table) == false)
+        continue;
+
+      EXPECT_TRUE(triplets.erase(indivs[i], property, table));
+      EXPECT_FALSE(triplets.exist(indivs[i], property, table));
+      EXPECT_FALSE(triplets.erase(indivs[i], property, table));
+
+      for(size_t j = 0; j < triplets.size(); j++)
+      {
+        auto& triplet = triplets.triplets[j];
+        EXPECT_EQ(triplets.find(triplet.subject, triplet.predicate, triplet.object), j) << triplet.subject->value();
+      }
+    }
+
+  EXPECT_EQ(triplets.size(), 0);
+}
+
+TEST(feature_inductions, retraction)
+{
+  ontologenius::Ontology onto;
+  onto.setDisplay(false);
+  onto.close();
+
+  auto indivs = createIndividuals(onto, NB_INDUCED);
+  auto* cube = onto.individual_graph_.findOrCreateBranchSafe("cube");
+  auto* table = onto.individual_graph_.findOrCreateBranchSafe("table");
+  auto* is_on = onto.object_property_graph_.findOrCreateBranch("isOn");
+  auto* is_near = onto.object_property_graph_.findOrCreateBranch("isNear");
+
+  // as done by the reasoners, the relations induced by cube|isOn|table are traced
+  const int cause = onto.individual_graph_.addRelation(cube, is_on, table);
+  auto* induced = cube->object_relations_.has_induced_object_relations[cause];
+  for(auto* indiv : indivs)
+  {
+    const int index = onto.individual_graph_.addRelation(indiv, is_near, table, 1.0, true);
+    induced->push(indiv, is_near, table);
+    indiv->object_relations_[index].induced_traces.emplace_back(induced);
+  }
+
+  // an induced relation removed on its own leaves the trace
+  onto.individual_graph_.removeRelation(indivs[1]->value(), "isNear", "table");
+  EXPECT_EQ(induced->size(), NB_INDUCED - 1);
+  EXPECT_FALSE(induced->exist(indivs[1], is_near, table));
+
+  // an induced relation later stated is kept
+  onto.individual_graph_.addRelation(indivs[0], is_near, table);
+
+  onto.individual_graph_.removeRelation("cube", "isOn", "table");
+
+  EXPECT_TRUE(onto.individual_graph_.getOn("cube", "isOn").empty());
+  EXPECT_EQ(onto.individual_graph_.getFrom("table", "isNear"), std::unordered_set<std::string>({indivs[0]->value()}));
+  for(size_t i = 1; i < indivs.size(); i++)
+    EXPECT_EQ(indivs[i]->object_relations_.size(), 0) << indivs[i]->value();
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
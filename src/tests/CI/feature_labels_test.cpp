@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <regex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "ontologenius/core/Algorithms/LevenshteinDistance.h"
+#include "ontologenius/core/ontoGraphs/Ontology.h"
+#include "ontologenius/utils/Commands.h"
+
+using Names_t = std::unordered_set<std::string>;
+
+ontologenius::Ontology* onto_ptr;
+
+const std::vector<std::string> sentences = {"kitchen", "Kitchen", "kitch", "", "room", "zone intérieure", "indoor area",
+                                            "I am in the kitchen", "the kitchens of the indoor areas", "a temperature sensor in a room",
+                                            "capteur de mouvement", "non-living entity", "cooking room", "a cooking room"};
+const std::vector<std::string> regexes = {"kitch.*", ".*sensor", "capteur de .*", "[a-z]+ area", "Kitchen|room", "cooking.*", "(", ".*"};
+const std::vector<std::string> fuzzy_values = {"kitchn", "temperatur sensor", "rom", "zzzzzzzz", "indor area", "cookin room", "cuisine"};
+
+// The searches are checked against a scan of every label of the graph language,
+// as they were done before the label index
+
+std::vector<std::string> getLabels(ontologenius::ClassBranch* branch, bool use_default)
+{
+  std::vector<std::string> labels;
+  if(use_default)
+    labels.push_back(branch->value());
+  const std::string lang = onto_ptr->class_graph_.getLanguage();
+  branch->dictionary_.spoken_.forEach(lang, [&labels](const std::string& word) { labels.push_back(word); });
+  branch->dictionary_.muted_.forEach(lang, [&labels](const std::string& word) { labels.push_back(word); });
+  return labels;
+}
+
+Names_t scanFind(const std::string& value, bool use_default)
+{
+  Names_t res;
+  for(auto* branch : onto_ptr->class_graph_.all_branchs_)
+    for(auto& label : getLabels(branch, use_default))
+      if(label == value)
+        res.insert(branch->value());
+  return res;
+}
+
+Names_t scanFindSub(const std::string& value, bool use_default)
+{
+  Names_t res;
+  std::smatch match;
+  for(auto* branch : onto_ptr->class_graph_.all_branchs_)
+    for(auto& label : getLabels(branch, use_default))
+      if(std::regex_search(value, match, std::regex("\\b(" + label + ")([^ ]*)")))
+        res.insert(branch->value());
+  return res;
+}
+
+Names_t scanFindRegex(const std::string& regex, bool use_default)
+{
+  Names_t res;
+  std::regex base_regex;
+  try
+  {
+    base_regex = std::regex(regex);
+  }
+  catch(std::regex_error& e)
+  {
+    return res;
+  }
+
+  std::smatch match;
+  for(auto* branch : onto_ptr->class_graph_.all_branchs_)
+    for(auto& label : getLabels(branch, use_default))
+      if(std::regex_match(label, match, base_regex))
+        res.insert(branch->value());
+  return res;
+}
+
+Names_t scanFindFuzzy(const std::string& value, bool use_default, double threshold)
+{
+  Names_t res;
+  double lower_cost = 100000;
+  ontologenius::LevenshteinDistance dist;
+  for(auto* branch : onto_ptr->class_graph_.all_branchs_)
+    for(auto& label : getLabels(branch, use_default))
+    {
+      const double cost = dist.get(label, value);
+      if(cost < lower_cost)
+      {
+        lower_cost = cost;
+        res.clear();
+      }
+      if(cost == lower_cost)
+        res.insert(label);
+    }
+
+  if(lower_cost > threshold)
+    res.clear();
+  return res;
+}
+
+void checkSearches()
+{
+  auto& graph = onto_ptr->class_graph_;
+  for(bool use_default : {true, false})
+  {
+    for(auto& sentence : sentences)
+    {
+      EXPECT_EQ(graph.find<std::string>(sentence, use_default), scanFind(sentence, use_default)) << sentence;
+      EXPECT_EQ(graph.findSub<std::string>(sentence, use_default), scanFindSub(sentence, use_default)) << sentence;
+    }
+
+    for(auto& regex : regexes)
+      EXPECT_EQ(graph.findRegex<std::string>(regex, use_default), scanFindRegex(regex, use_default)) << regex;
+
+    for(auto& value : fuzzy_values)
+      for(double threshold : {0.2, 0.5})
+        EXPECT_EQ(graph.findFuzzy(value, use_default, threshold), scanFindFuzzy(value, use_default, threshold)) << value << " " << threshold;
+  }
+}
+
+TEST(feature_labels, loaded_labels)
+{
+  checkSearches();
+
+  auto& graph = onto_ptr->class_graph_;
+  EXPECT_EQ(graph.find<std::string>("kitchen"), Names_t({"Kitchen"}));
+  EXPECT_EQ(graph.find<std::string>("Kitchen", false), Names_t());
+  EXPECT_EQ(graph.find<std::string>("indoor area"), Names_t({"IndoorArea"}));
+  EXPECT_EQ(graph.findSub<std::string>("I am in the kitchen").count("Kitchen"), 1);
+  EXPECT_EQ(graph.findRegex<std::string>("kitch.*"), Names_t({"Kitchen"}));
+  EXPECT_EQ(graph.findFuzzy("kitchn"), Names_t({"kitchen"}));
+  EXPECT_EQ(graph.findFuzzy("zzzzzzzz"), Names_t());
+}
+
+TEST(feature_labels, runtime_labels)
+{
+  auto& graph = onto_ptr->class_graph_;
+
+  EXPECT_TRUE(graph.addLang("Kitchen", "@en", "cooking room"));
+  checkSearches();
+  EXPECT_EQ(graph.find<std::string>("cooking room"), Names_t({"Kitchen"}));
+  EXPECT_EQ(graph.findSub<std::string>("a cooking room").count("Kitchen"), 1);
+  EXPECT_EQ(graph.findRegex<std::string>("cooking.*"), Names_t({"Kitchen"}));
+  EXPECT_EQ(graph.findFuzzy("cookin room"), Names_t({"cooking room"}));
+
+  EXPECT_TRUE(graph.removeLang("Kitchen", "@en", "kitchen"));
+  checkSearches();
+  EXPECT_EQ(graph.find<std::string>("kitchen"), Names_t());
+  EXPECT_EQ(graph.find<std::string>("cooking room"), Names_t({"Kitchen"}));
+  EXPECT_EQ(graph.findRegex<std::string>("kitch.*"), Names_t());
+
+  // the labels of the other languages are only searched once the language is set
+  EXPECT_TRUE(graph.addLang("Room", "@fr", "salle"));
+  EXPECT_EQ(graph.find<std::string>("salle"), Names_t());
+  graph.setLanguage("fr");
+  checkSearches();
+  EXPECT_EQ(graph.find<std::string>("salle"), Names_t({"Room"}));
+  EXPECT_EQ(graph.find<std::string>("cuisine"), Names_t({"Kitchen"}));
+  graph.setLanguage("en");
+
+  EXPECT_TRUE(graph.removeLang("Kitchen", "@en", "cooking room"));
+  EXPECT_TRUE(graph.addLang("Kitchen", "@en", "kitchen"));
+  checkSearches();
+  EXPECT_EQ(graph.find<std::string>("cooking room"), Names_t());
+  EXPECT_EQ(graph.find<std::string>("kitchen"), Names_t({"Kitchen"}));
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  ontologenius::Ontology onto;
+  onto.setDisplay(false);
+  onto_ptr = &onto;
+
+  const std::string path_base = ontologenius::findPackage("ontologenius");
+  onto.readFromFile(path_base + "/files/attribute.owl");
+  onto.readFromFile(path_base + "/files/positionProperty.owl");
+  onto.close();
+
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ontologenius/core/ontoGraphs/Ontology.h"
+#include "ontologenius/utils/Commands.h"
+
+#define NB_CALLS 20
+
+std::map<std::string, std::string> getNames(bool deterministic)
+{
+  ontologenius::Ontology onto;
+  onto.setDisplay(false);
+  onto.setDeterministicNames(deterministic);
+
+  const std::string path_base = ontologenius::findPackage("ontologenius");
+  onto.readFromFile(path_base + "/files/attribute.owl");
+  onto.readFromFile(path_base + "/files/positionProperty.owl");
+  onto.close();
+
+  std::map<std::string, std::string> res;
+  for(auto& class_name : onto.class_graph_.getAll())
+  {
+    const std::string name = onto.class_graph_.getName(class_name);
+    if(deterministic)
+    {
+      // the first name without underscore
+      std::string expected;
+      for(auto& candidate : onto.class_graph_.getNames(class_name))
+        if(expected.empty() || ((expected.find('_') != std::string::npos) && (candidate.find('_') == std::string::npos)))
+          expected = candidate;
+      EXPECT_EQ(name, expected) << class_name;
+
+      for(size_t i = 0; i < NB_CALLS; i++)
+        EXPECT_EQ(onto.class_graph_.getName(class_name), name) << class_name;
+    }
+    else
+    {
+      auto names = onto.class_graph_.getNames(class_name);
+      EXPECT_NE(std::find(names.begin(), names.end(), name), names.end()) << class_name;
+    }
+    res.emplace(class_name, name);
+  }
+
+  return res;
+}
+
+TEST(feature_names, deterministic_names)
+{
+  auto first_run = getNames(true);
+  auto second_run = getNames(true);
+  EXPECT_FALSE(first_run.empty());
+  EXPECT_EQ(first_run, second_run);
+}
+
+TEST(feature_names, random_names)
+{
+  auto names = getNames(false);
+  EXPECT_FALSE(names.empty());
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "ontologenius/core/feeder/FeedStorage.h"
+#include "ontologenius/core/feeder/Versionor.h"
+
+#define NB_VERSIONS 300
+#define NB_CHECKOUTS 100
+
+using State_t = std::set<std::string>;
+
+ontologenius::Feed_t getFeed(ontologenius::Action_e action, const std::string& from, const std::string& on)
+{
+  ontologenius::Feed_t feed;
+  feed.action_ = action;
+  feed.from_ = from;
+  feed.prop_ = "isOn";
+  feed.on_ = on;
+  return feed;
+}
+
+void applyFeed(const ontologenius::Feed_t& feed, State_t& state)
+{
+  const std::string fact = feed.from_ + "|" + feed.prop_ + "|" + feed.on_;
+  if(feed.action_ == ontologenius::action_add)
+    state.insert(fact);
+  else
+    state.erase(fact);
+}
+
+// Commits random versions, from random checkouts, and checks that each checkout gives
+// back the state which was committed, as replayed fact by fact.
+size_t replayCheckouts(size_t snapshots_max_size)
+{
+  ontologenius::Versionor versionor;
+  versionor.activate(true);
+  versionor.setSnapshotsMaxSize(snapshots_max_size);
+
+  std::mt19937 rng(42);
+  State_t current;
+  std::map<std::string, State_t> committed;
+  std::vector<std::string> ids;
+  size_t nb_errors = 0;
+
+  auto checkout = [&](const std::string& id) {
+    std::vector<ontologenius::Feed_t> datas;
+    EXPECT_TRUE(versionor.checkout(id, datas));
+    for(auto& data : datas)
+      applyFeed(data, current);
+    if(current != committed[id])
+      nb_errors++;
+  };
+
+  for(size_t version = 0; version < NB_VERSIONS; version++)
+  {
+    const size_t nb_facts = rng() % 40;
+    for(size_t i = 0; i < nb_facts; i++)
+    {
+      const std::string from = "obj_" + std::to_string(rng() % 30);
+      const std::string on = "obj_" + std::to_string(rng() % 30);
+      auto action = (current.find(from + "|isOn|" + on) == current.end()) ? ontologenius::action_add : ontologenius::action_del;
+      auto feed = getFeed(action, from, on);
+      versionor.insert(feed);
+      applyFeed(feed, current);
+    }
+
+    const std::string id = "v" + std::to_string(version);
+    EXPECT_TRUE(versionor.commit(id));
+    committed[id] = current;
+    ids.push_back(id);
+
+    if(version % 7 == 6)
+      checkout(ids[rng() % ids.size()]);
+  }
+
+  for(size_t i = 0; i < NB_CHECKOUTS; i++)
+    checkout(ids[rng() % ids.size()]);
+
+  return nb_errors;
+}
+
+TEST(feature_versioning, checkout_chain)
+{
+  EXPECT_EQ(replayCheckouts(1000000), 0);
+}
+
+TEST(feature_versioning, checkout_chain_dropped_snapshots)
+{
+  // only a few snapshots are kept, the others are computed again from the deltas
+  EXPECT_EQ(replayCheckouts(1000), 0);
+}
+
+TEST(feature_versioning, discarded_words)
+{
+  ontologenius::Versionor versionor;
+  versionor.activate(true);
+  versionor.insert(getFeed(ontologenius::action_add, "robot", "table"));
+  EXPECT_TRUE(versionor.commit("v0"));
+  const size_t nb_words = versionor.getNbWords();
+
+  // the uncommitted changes are discarded by each checkout, with their words
+  std::vector<ontologenius::Feed_t> datas;
+  for(size_t i = 0; i < 100; i++)
+  {
+    versionor.insert(getFeed(ontologenius::action_add, "obj_" + std::to_string(i), "table"));
+    EXPECT_TRUE(versionor.checkout("v0", datas));
+    EXPECT_EQ(versionor.getNbWords(), nb_words);
+  }
+
+  versionor.insert(getFeed(ontologenius::action_add, "cup", "table"));
+  EXPECT_TRUE(versionor.commit("v1"));
+  EXPECT_TRUE(versionor.checkout("v0", datas));
+  EXPECT_TRUE(versionor.checkout("v1", datas));
+  ASSERT_EQ(datas.size(), 1);
+  EXPECT_EQ(datas.front().from_, "cup");
+  EXPECT_EQ(versionor.getNbWords(), nb_words + 1);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
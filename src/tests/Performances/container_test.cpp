@@ -67,6 +67,8 @@ private:
 
 using namespace std::chrono;
 
+ontologenius::WordTable table;
+ontologenius::LabelTable label_table;
 std::vector<ontologenius::ValuedNode*> full_words;
 
 void readFullWords()
@@ -80,7 +82,7 @@ void readFullWords()
       oef = true;
     else
     {
-      auto* tmp = new ontologenius::ValuedNode(res);
+      auto* tmp = new ontologenius::ValuedNode(res, &table, &label_table);
       full_words.push_back(tmp);
     }
   } while(oef == false);
@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "ontologenius/core/feeder/FeedStorage.h"
+
+using namespace std::chrono;
+using namespace ontologenius;
+
+// The parsing done by FeedStorage before it uses its own tokenizer
+class RegexParser
+{
+public:
+  RegexParser() : base_regex_(R"(^\[(\w+)\](.*)\|(.*)\|(.*)$)"),
+                  simple_regex_(R"(^\[(\w+)\](.*)\|$)")
+  {}
+
+  bool parse(const std::string& str, Feed_t& feed)
+  {
+    std::smatch base_match;
+    if(std::regex_match(str, base_match, base_regex_))
+    {
+      std::string action = base_match[1].str();
+      std::transform(action.begin(), action.end(), action.begin(), ::tolower);
+      if(action == "add")
+        feed.action_ = action_add;
+      else if(action == "del")
+        feed.action_ = action_del;
+      else if(action == "nop")
+        feed.action_ = action_nop;
+      else
+        return false;
+      feed.from_ = base_match[2].str();
+      feed.prop_ = base_match[3].str();
+      feed.on_ = base_match[4].str();
+    }
+    else if(std::regex_match(str, base_match, simple_regex_))
+    {
+      std::string action = base_match[1].str();
+      std::transform(action.begin(), action.end(), action.begin(), ::tolower);
+      if(action == "add")
+        feed.action_ = action_add;
+      else if(action == "del")
+        feed.action_ = action_del;
+      else if(action == "commit")
+        feed.action_ = action_commit;
+      else if(action == "checkout")
+        feed.action_ = action_checkout;
+      else if(action == "nop")
+        feed.action_ = action_nop;
+      else
+        return false;
+      feed.from_ = base_match[2].str();
+    }
+    else if(str == "[nop]")
+      feed.action_ = action_nop;
+    else
+      return false;
+
+    return true;
+  }
+
+private:
+  std::regex base_regex_;
+  std::regex simple_regex_;
+};
+
+std::vector<std::string> getFeeds(size_t nb)
+{
+  std::vector<std::string> res;
+  res.reserve(nb);
+  for(size_t i = 0; i < nb; i++)
+  {
+    std::string id = std::to_string(i);
+    switch(i % 5)
+    {
+    case 0: res.push_back("[add]VP" + id + "|+|VisualPerception"); break;
+    case 1: res.push_back("[add]VP" + id + "|actOn|cup" + id); break;
+    case 2: res.push_back("[add]VP" + id + "|occursAt|mat#[[1,0,0,2.56], [0,1,0,1.32],[0,0,1,0.38],[0,0,0,1]]"); break;
+    case 3: res.push_back("[del]cup" + id + "|@en|cup number " + id); break;
+    default: res.push_back("[commit]commit" + id + "|"); break;
+    }
+  }
+  return res;
+}
+
+bool isSame(const Feed_t& a, const Feed_t& b)
+{
+  return (a.action_ == b.action_) && (a.from_ == b.from_) && (a.prop_ == b.prop_) && (a.on_ == b.on_);
+}
+
+int main()
+{
+  const size_t nb_feeds = 200000;
+  std::vector<std::string> feeds = getFeeds(nb_feeds);
+
+  RegexParser regex_parser;
+  std::vector<Feed_t> regex_res(nb_feeds);
+  high_resolution_clock::time_point t1 = high_resolution_clock::now();
+  for(size_t i = 0; i < nb_feeds; i++)
+    regex_parser.parse(feeds[i], regex_res[i]);
+  high_resolution_clock::time_point t2 = high_resolution_clock::now();
+  duration<double> regex_span = duration_cast<duration<double>>(t2 - t1);
+
+  std::vector<Feed_t> res(nb_feeds);
+  t1 = high_resolution_clock::now();
+  for(size_t i = 0; i < nb_feeds; i++)
+    FeedStorage::parse(feeds[i], res[i]);
+  t2 = high_resolution_clock::now();
+  duration<double> span = duration_cast<duration<double>>(t2 - t1);
+
+  size_t nb_diff = 0;
+  for(size_t i = 0; i < nb_feeds; i++)
+    if(isSame(regex_res[i], res[i]) == false)
+      nb_diff++;
+
+  std::cout << "regex : " << regex_span.count() << "s => " << (double)nb_feeds / regex_span.count() << " feeds/s" << std::endl;
+  std::cout << "tokenizer : " << span.count() << "s => " << (double)nb_feeds / span.count() << " feeds/s" << std::endl;
+  std::cout << "speedup : " << regex_span.count() / span.count() << std::endl;
+  std::cout << "different results : " << nb_diff << std::endl;
+
+  return (nb_diff == 0) ? 0 : 1;
+}